@@ -0,0 +1,161 @@
+#define ALICE_NO_ENTRY_POINT 1
+#include "main.cpp"
+
+//
+// Runs only the daily economy update, repeatedly and always from the same snapshot of the game, so that timings can be compared
+// between builds. The snapshot is taken with the save section writer after the scenario (and the optional save) has been loaded,
+// and every run restores it before updating the economy once. Besides the timings of economy::daily_update and its profiled
+// sub-phases, every run prints a checksum of all market prices: it must be the same for every run of one build, and a change of
+// checksum between two builds means that a change altered the results of the economy and not only its speed
+//
+
+static void print_usage(char const* name) {
+	std::printf("Usage: %s [scenario.bin] [-save save.bin] [-runs N] [-seed N]\n", name);
+	std::printf("The scenario is read from the scenario directory and the save from the save game directory\n");
+}
+
+static uint64_t market_price_checksum(sys::state& state) {
+	// FNV-1a over the bits of every price
+	uint64_t hash = 14695981039346656037ull;
+	auto add = [&](float value) {
+		uint32_t bits = 0;
+		std::memcpy(&bits, &value, sizeof(bits));
+		for(uint32_t i = 0; i < 4; ++i) {
+			hash ^= uint64_t((bits >> (i * 8)) & 0xFF);
+			hash *= 1099511628211ull;
+		}
+	};
+	for(auto m : state.world.in_market) {
+		for(auto c : state.world.in_commodity) {
+			add(state.world.market_get_price(m, c));
+		}
+		add(state.world.market_get_labor_unskilled_price(m));
+		add(state.world.market_get_labor_skilled_price(m));
+	}
+	return hash;
+}
+
+static void merge_phases(std::vector<sys::tick_phase_summary>& totals, sys::tick_day_record const& day) {
+	for(auto& p : day.phases) {
+		auto it = std::find_if(totals.begin(), totals.end(), [&](sys::tick_phase_summary const& s) { return s.name == p.name; });
+		if(it == totals.end()) {
+			totals.push_back(sys::tick_phase_summary{ p.name, 0, 0, 0, 0 });
+			it = totals.end() - 1;
+		}
+		it->total_microseconds += p.microseconds;
+		it->max_microseconds = std::max(it->max_microseconds, p.microseconds);
+		it->max_workers = std::max(it->max_workers, p.workers);
+		++(it->samples);
+	}
+}
+
+int main(int argc, char** argv) {
+	if(argc <= 1) {
+		print_usage(argv[0]);
+		return EXIT_FAILURE;
+	}
+
+	native_string scenario_file = simple_fs::utf8_to_native(argv[1]);
+	native_string save_file;
+	int32_t runs = 10;
+	bool fixed_seed = false;
+	uint32_t seed = 0;
+	for(int i = 2; i < argc; ++i) {
+		std::string_view arg = argv[i];
+		if(arg == "-save" && i + 1 < argc) {
+			save_file = simple_fs::utf8_to_native(argv[i + 1]);
+			++i;
+		} else if(arg == "-runs" && i + 1 < argc) {
+			runs = std::max(1, std::atoi(argv[i + 1]));
+			++i;
+		} else if(arg == "-seed" && i + 1 < argc) {
+			fixed_seed = true;
+			seed = uint32_t(std::strtoul(argv[i + 1], nullptr, 10));
+			++i;
+		} else {
+			print_usage(argv[0]);
+			return EXIT_FAILURE;
+		}
+	}
+
+	std::unique_ptr<sys::state> game_state = std::make_unique<sys::state>(); // too big for the stack
+	add_root(game_state->common_fs, NATIVE("."));
+
+	if(!sys::try_read_scenario_and_save_file(*game_state, scenario_file)) {
+		std::printf("Scenario file %s could not be read\n", argv[1]);
+		return EXIT_FAILURE;
+	}
+	game_state->loaded_scenario_file = scenario_file;
+	if(!save_file.empty()) {
+		game_state->preload();
+		if(!sys::try_read_save_file(*game_state, save_file)) {
+			std::printf("Save file %s could not be read (it must have been made with the same scenario)\n", simple_fs::native_to_utf8(save_file).c_str());
+			return EXIT_FAILURE;
+		}
+	}
+	if(fixed_seed)
+		game_state->game_seed = seed;
+
+	for(auto n : game_state->world.in_nation)
+		n.set_is_player_controlled(false);
+	game_state->local_player_nation = game_state->world.national_identity_get_nation_from_identity_holder(game_state->national_definitions.rebel_id);
+	game_state->user_settings.autosaves = sys::autosave_frequency::none;
+
+	game_state->fill_unsaved_data();
+
+	size_t snapshot_length = sys::sizeof_save_section(*game_state);
+	auto snapshot = std::unique_ptr<uint8_t[]>(new uint8_t[snapshot_length]);
+	sys::write_save_section(snapshot.get(), *game_state);
+
+	auto ymd = game_state->current_date.to_ymd(game_state->start_date);
+	std::printf("Snapshot of %d.%d.%d taken (%.1f MB), running the economy update %d times\n", int32_t(ymd.year), int32_t(ymd.month),
+		int32_t(ymd.day), double(snapshot_length) / (1024.0 * 1024.0), runs);
+
+	game_state->tick_profile.enabled.store(true, std::memory_order_relaxed);
+	std::vector<sys::tick_phase_summary> totals;
+	std::vector<uint64_t> checksums;
+
+	for(int32_t run = 0; run < runs; ++run) {
+		game_state->preload();
+		sys::read_save_section(snapshot.get(), snapshot.get() + snapshot_length, *game_state);
+		game_state->fill_unsaved_data();
+
+		game_state->tick_profile.begin_day(game_state->current_date);
+		{
+			sys::tick_phase_scope phase{ game_state->tick_profile, "update_rgo_employment" };
+			economy::update_rgo_employment(*game_state);
+		}
+		{
+			sys::tick_phase_scope phase{ game_state->tick_profile, "update_factory_employment" };
+			economy::update_factory_employment(*game_state);
+		}
+		{
+			sys::tick_phase_scope phase{ game_state->tick_profile, "economy_daily_update" };
+			economy::daily_update(*game_state, false, 1.f);
+		}
+		game_state->tick_profile.end_day();
+
+		auto day = game_state->tick_profile.most_recent_day();
+		merge_phases(totals, day);
+		checksums.push_back(market_price_checksum(*game_state));
+		std::printf("Run %d: %.2fms, price checksum %016llx\n", run + 1, double(day.total_microseconds) / 1000.0, (unsigned long long)(checksums.back()));
+	}
+
+	std::sort(totals.begin(), totals.end(), [](sys::tick_phase_summary const& a, sys::tick_phase_summary const& b) {
+		if(a.total_microseconds != b.total_microseconds)
+			return a.total_microseconds > b.total_microseconds;
+		return a.name < b.name;
+	});
+	std::printf("%-48s %10s %10s %6s\n", "phase", "avg us", "max us", "runs");
+	for(auto& p : totals) {
+		std::printf("%-48.*s %10lld %10lld %6d\n", int(p.name.size()), p.name.data(),
+			(long long)(p.total_microseconds / std::max(p.samples, 1)), (long long)(p.max_microseconds), p.samples);
+	}
+
+	if(std::adjacent_find(checksums.begin(), checksums.end(), std::not_equal_to<>()) != checksums.end()) {
+		std::printf("Price checksums differ between runs of the same snapshot: the economy update is not deterministic\n");
+		return EXIT_FAILURE;
+	}
+	std::printf("Price checksum: %016llx\n", (unsigned long long)(checksums.front()));
+	return EXIT_SUCCESS;
+}
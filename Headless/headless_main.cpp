@@ -0,0 +1,175 @@
+#define ALICE_NO_ENTRY_POINT 1
+#include "main.cpp"
+
+//
+// Runs the simulation without a window, graphics or sound: loads a scenario (and optionally a save made with it) and advances
+// the game as fast as possible for the requested number of days, with every nation controlled by the ai. Used to measure
+// simulation throughput, for example to benchmark mods or to catch performance regressions on machines without a gpu
+//
+
+static void print_usage(char const* name) {
+	std::printf("Usage: %s [scenario.bin] [-save save.bin] [-days N] [-seed N] [-jit-compare] [-script-profile N]\n", name);
+	std::printf("The scenario is read from the scenario directory and the save from the save game directory\n");
+}
+
+static void merge_phases(std::vector<sys::tick_phase_summary>& totals, sys::tick_day_record const& day) {
+	for(auto& p : day.phases) {
+		auto it = std::find_if(totals.begin(), totals.end(), [&](sys::tick_phase_summary const& s) { return s.name == p.name; });
+		if(it == totals.end()) {
+			totals.push_back(sys::tick_phase_summary{ p.name, 0, 0, 0, 0 });
+			it = totals.end() - 1;
+		}
+		it->total_microseconds += p.microseconds;
+		it->max_microseconds = std::max(it->max_microseconds, p.microseconds);
+		it->max_workers = std::max(it->max_workers, p.workers);
+		++(it->samples);
+	}
+}
+
+int main(int argc, char** argv) {
+	if(argc <= 1) {
+		print_usage(argv[0]);
+		return EXIT_FAILURE;
+	}
+
+	native_string scenario_file = simple_fs::utf8_to_native(argv[1]);
+	native_string save_file;
+	int32_t days = 365;
+	bool fixed_seed = false;
+	bool jit_compare = false;
+	int32_t script_profile_entries = 0;
+	uint32_t seed = 0;
+	for(int i = 2; i < argc; ++i) {
+		std::string_view arg = argv[i];
+		if(arg == "-save" && i + 1 < argc) {
+			save_file = simple_fs::utf8_to_native(argv[i + 1]);
+			++i;
+		} else if(arg == "-days" && i + 1 < argc) {
+			days = std::max(0, std::atoi(argv[i + 1]));
+			++i;
+		} else if(arg == "-seed" && i + 1 < argc) {
+			fixed_seed = true;
+			seed = uint32_t(std::strtoul(argv[i + 1], nullptr, 10));
+			++i;
+		} else if(arg == "-jit-compare") {
+			jit_compare = true;
+		} else if(arg == "-script-profile" && i + 1 < argc) {
+			script_profile_entries = std::max(0, std::atoi(argv[i + 1]));
+			++i;
+		} else {
+			print_usage(argv[0]);
+			return EXIT_FAILURE;
+		}
+	}
+
+	std::unique_ptr<sys::state> game_state = std::make_unique<sys::state>(); // too big for the stack
+	add_root(game_state->common_fs, NATIVE("."));
+
+	auto load_start = std::chrono::steady_clock::now();
+	if(!sys::try_read_scenario_and_save_file(*game_state, scenario_file)) {
+		std::printf("Scenario file %s could not be read\n", argv[1]);
+		return EXIT_FAILURE;
+	}
+	game_state->loaded_scenario_file = scenario_file;
+	if(!save_file.empty()) {
+		game_state->preload();
+		if(!sys::try_read_save_file(*game_state, save_file)) {
+			std::printf("Save file %s could not be read (it must have been made with the same scenario)\n", simple_fs::native_to_utf8(save_file).c_str());
+			return EXIT_FAILURE;
+		}
+	}
+	if(fixed_seed)
+		game_state->game_seed = seed;
+
+	// spectate: nobody is player controlled
+	for(auto n : game_state->world.in_nation)
+		n.set_is_player_controlled(false);
+	game_state->local_player_nation = game_state->world.national_identity_get_nation_from_identity_holder(game_state->national_definitions.rebel_id);
+	game_state->user_settings.autosaves = sys::autosave_frequency::none;
+
+	game_state->fill_unsaved_data();
+	// reused paths depend on thread timing, which would make the checksum of a run differ between runs with the same seed
+	game_state->defines.alice_path_cache_size = 0.0f;
+	auto load_end = std::chrono::steady_clock::now();
+
+	auto start_ymd = game_state->current_date.to_ymd(game_state->start_date);
+	std::printf("Loaded in %.2fs, starting at %d.%d.%d with seed %u\n",
+		double(std::chrono::duration_cast<std::chrono::milliseconds>(load_end - load_start).count()) / 1000.0,
+		int32_t(start_ymd.year), int32_t(start_ymd.month), int32_t(start_ymd.day), game_state->game_seed);
+
+	game_state->tick_profile.enabled.store(true, std::memory_order_relaxed);
+	game_state->jit_compare_mode.store(jit_compare, std::memory_order_relaxed);
+	if(script_profile_entries > 0) {
+		game_state->script_profile.reset(*game_state);
+		game_state->script_profile.enabled.store(true, std::memory_order_relaxed);
+	}
+	std::vector<sys::tick_phase_summary> totals;
+
+	int32_t days_run = 0;
+	int64_t slowest_day = 0;
+	auto run_start = std::chrono::steady_clock::now();
+	for(; days_run < days; ++days_run) {
+		if(!sys::is_playable_date(game_state->current_date + 1, game_state->start_date, game_state->end_date))
+			break;
+		game_state->single_game_tick();
+
+		auto day = game_state->tick_profile.most_recent_day();
+		merge_phases(totals, day);
+		slowest_day = std::max(slowest_day, day.total_microseconds);
+	}
+	auto run_end = std::chrono::steady_clock::now();
+
+	auto seconds = double(std::chrono::duration_cast<std::chrono::microseconds>(run_end - run_start).count()) / 1000000.0;
+	auto end_ymd = game_state->current_date.to_ymd(game_state->start_date);
+	std::printf("Ran %d days (to %d.%d.%d) in %.2fs: %.2f days/sec, slowest day %.2fms\n", days_run,
+		int32_t(end_ymd.year), int32_t(end_ymd.month), int32_t(end_ymd.day), seconds,
+		seconds > 0.0 ? double(days_run) / seconds : 0.0, double(slowest_day) / 1000.0);
+
+	std::sort(totals.begin(), totals.end(), [](sys::tick_phase_summary const& a, sys::tick_phase_summary const& b) {
+		if(a.total_microseconds != b.total_microseconds)
+			return a.total_microseconds > b.total_microseconds;
+		return a.name < b.name;
+	});
+	std::printf("%-48s %12s %10s %10s %6s %5s\n", "phase", "total ms", "avg us", "max us", "runs", "conc");
+	for(auto& p : totals) {
+		std::printf("%-48.*s %12.2f %10lld %10lld %6d %5d\n", int(p.name.size()), p.name.data(), double(p.total_microseconds) / 1000.0,
+			(long long)(p.total_microseconds / std::max(p.samples, 1)), (long long)(p.max_microseconds), p.samples, p.max_workers);
+	}
+
+	int64_t path_cache_hits = 0;
+	int64_t path_cache_misses = 0;
+	for(auto& counter : game_state->tick_profile.counter_totals()) {
+		std::printf("%-48.*s %12lld\n", int(counter.name.size()), counter.name.data(), (long long)(counter.value));
+		if(counter.name == "path_cache_hits")
+			path_cache_hits = counter.value;
+		else if(counter.name == "path_cache_misses")
+			path_cache_misses = counter.value;
+	}
+	if(path_cache_hits + path_cache_misses > 0) {
+		std::printf("Path cache hit rate: %.1f%%\n", 100.0 * double(path_cache_hits) / double(path_cache_hits + path_cache_misses));
+	}
+
+	if(jit_compare) {
+		std::printf("JIT compare: %lld of %lld results differed from the interpreter\n",
+			(long long)(game_state->jit_mismatches.load()), (long long)(game_state->jit_comparisons.load()));
+	}
+
+	if(script_profile_entries > 0) {
+		auto scripts = game_state->script_profile.summarize(*game_state);
+		std::printf("%-16s %8s %12s %12s %12s  %s\n", "script", "key", "total ms", "calls", "lanes", "source");
+		for(int32_t i = 0; i < script_profile_entries && i < int32_t(scripts.size()); ++i) {
+			auto& entry = scripts[i];
+			auto kind = entry.kind == sys::script_kind::trigger ? "trigger" : (entry.kind == sys::script_kind::value_modifier ? "value_modifier" : "effect");
+			std::printf("%-16s %8d %12.2f %12lld %12lld  %s\n", kind, entry.key_index, double(entry.nanoseconds) / 1000000.0,
+				(long long)(entry.calls), (long long)(entry.lanes), entry.source.c_str());
+		}
+	}
+
+	auto checksum = game_state->get_save_checksum();
+	std::printf("Checksum: ");
+	for(uint32_t i = 0; i < sys::checksum_key::key_size; ++i)
+		std::printf("%02x", uint32_t(checksum.key[i]));
+	std::printf("\n");
+
+	return EXIT_SUCCESS;
+}
@@ -782,144 +782,168 @@ void identify_focuses(sys::state& state) {
 	}
 }
 
-void update_focuses(sys::state& state) {
-	for(auto si : state.world.in_state_instance) {
-		if(!si.get_nation_from_state_ownership().get_is_player_controlled())
-			si.set_owner_focus(dcon::national_focus_id{});
-	}
-
-	for(auto n : state.world.in_nation) {
-		if(n.get_is_player_controlled())
-			continue;
-		if(n.get_owned_province_count() == 0)
-			continue;
+struct ai_focus_intent {
+	dcon::state_instance_id state;
+	dcon::national_focus_id focus;
+};
 
-		n.set_state_from_flashpoint_focus(dcon::state_instance_id{});
+// picks the focuses of a nation, in the order in which they should be set; only reads the game state
+static void decide_focuses(sys::state& state, dcon::nation_id nid, std::vector<ai_focus_intent>& intents) {
+	auto n = fatten(state.world, nid);
+	if(n.get_is_player_controlled())
+		return;
+	if(n.get_owned_province_count() == 0)
+		return;
 
-		auto num_focuses_total = nations::max_national_focuses(state, n);
-		if(num_focuses_total <= 0)
-			return;
+	auto num_focuses_total = nations::max_national_focuses(state, n);
+	if(num_focuses_total <= 0)
+		return;
 
-		auto base_opt = state.world.pop_type_get_research_optimum(state.culture_definitions.clergy);
-		auto clergy_frac = n.get_demographics(demographics::to_key(state, state.culture_definitions.clergy)) / n.get_demographics(demographics::total);
-		bool max_clergy = clergy_frac >= base_opt;
+	auto base_opt = state.world.pop_type_get_research_optimum(state.culture_definitions.clergy);
+	auto clergy_frac = n.get_demographics(demographics::to_key(state, state.culture_definitions.clergy)) / n.get_demographics(demographics::total);
+	bool max_clergy = clergy_frac >= base_opt;
 
-		static std::vector<dcon::state_instance_id> ordered_states;
-		ordered_states.clear();
-		for(auto si : n.get_state_ownership()) {
-			ordered_states.push_back(si.get_state().id);
-		}
-		std::sort(ordered_states.begin(), ordered_states.end(), [&](auto a, auto b) {
-			auto apop = state.world.state_instance_get_demographics(a, demographics::total);
-			auto bpop = state.world.state_instance_get_demographics(b, demographics::total);
-			if(apop != bpop)
-				return apop > bpop;
-			else
-				return a.index() < b.index();
-		});
-		bool threatened = n.get_ai_is_threatened() || n.get_is_at_war();
-		for(uint32_t i = 0; num_focuses_total > 0 && i < ordered_states.size(); ++i) {
-			auto prov = state.world.state_instance_get_capital(ordered_states[i]);
-			if(max_clergy) {
-				if(threatened) {
-					auto nf = state.national_definitions.soldier_focus;
-					auto k = state.world.national_focus_get_limit(nf);
-					if(!k || trigger::evaluate(state, k, trigger::to_generic(prov), trigger::to_generic(n), -1)) {
-						assert(command::can_set_national_focus(state, n, ordered_states[i], nf));
-						state.world.state_instance_set_owner_focus(ordered_states[i], state.national_definitions.soldier_focus);
-						--num_focuses_total;
-					}
-				} else {
-					auto total = state.world.state_instance_get_demographics(ordered_states[i], demographics::total);
-					auto cfrac = state.world.state_instance_get_demographics(ordered_states[i], demographics::to_key(state, state.culture_definitions.clergy)) / total;
-					if(cfrac < state.defines.max_clergy_for_literacy * 0.8f && !state.world.province_get_is_colonial(state.world.state_instance_get_capital(ordered_states[i]))) {
-						auto nf = state.national_definitions.clergy_focus;
-						auto k = state.world.national_focus_get_limit(nf);
-						if(!k || trigger::evaluate(state, k, trigger::to_generic(prov), trigger::to_generic(n), -1)) {
-							assert(command::can_set_national_focus(state, n, ordered_states[i], nf));
-							state.world.state_instance_set_owner_focus(ordered_states[i], state.national_definitions.clergy_focus);
-							--num_focuses_total;
-						}
-					}
+	std::vector<dcon::state_instance_id> ordered_states;
+	for(auto si : n.get_state_ownership()) {
+		ordered_states.push_back(si.get_state().id);
+	}
+	std::sort(ordered_states.begin(), ordered_states.end(), [&](auto a, auto b) {
+		auto apop = state.world.state_instance_get_demographics(a, demographics::total);
+		auto bpop = state.world.state_instance_get_demographics(b, demographics::total);
+		if(apop != bpop)
+			return apop > bpop;
+		else
+			return a.index() < b.index();
+	});
+	bool threatened = n.get_ai_is_threatened() || n.get_is_at_war();
+	for(uint32_t i = 0; num_focuses_total > 0 && i < ordered_states.size(); ++i) {
+		auto prov = state.world.state_instance_get_capital(ordered_states[i]);
+		if(max_clergy) {
+			if(threatened) {
+				auto nf = state.national_definitions.soldier_focus;
+				auto k = state.world.national_focus_get_limit(nf);
+				if(!k || trigger::evaluate(state, k, trigger::to_generic(prov), trigger::to_generic(n), -1)) {
+					assert(command::can_set_national_focus(state, n, ordered_states[i], nf));
+					intents.push_back(ai_focus_intent{ ordered_states[i], state.national_definitions.soldier_focus });
+					--num_focuses_total;
 				}
 			} else {
-				// If we haven't maxxed out clergy on this state, then our number 1 priority is to maximize clergy
-				auto cfrac = state.world.state_instance_get_demographics(ordered_states[i], demographics::to_key(state, state.culture_definitions.clergy)) / state.world.state_instance_get_demographics(ordered_states[i], demographics::total);
-				if(cfrac < base_opt * 1.2f && !state.world.province_get_is_colonial(state.world.state_instance_get_capital(ordered_states[i]))) {
+				auto total = state.world.state_instance_get_demographics(ordered_states[i], demographics::total);
+				auto cfrac = state.world.state_instance_get_demographics(ordered_states[i], demographics::to_key(state, state.culture_definitions.clergy)) / total;
+				if(cfrac < state.defines.max_clergy_for_literacy * 0.8f && !state.world.province_get_is_colonial(state.world.state_instance_get_capital(ordered_states[i]))) {
 					auto nf = state.national_definitions.clergy_focus;
 					auto k = state.world.national_focus_get_limit(nf);
 					if(!k || trigger::evaluate(state, k, trigger::to_generic(prov), trigger::to_generic(n), -1)) {
 						assert(command::can_set_national_focus(state, n, ordered_states[i], nf));
-						state.world.state_instance_set_owner_focus(ordered_states[i], state.national_definitions.clergy_focus);
+						intents.push_back(ai_focus_intent{ ordered_states[i], state.national_definitions.clergy_focus });
 						--num_focuses_total;
 					}
 				}
 			}
+		} else {
+			// If we haven't maxxed out clergy on this state, then our number 1 priority is to maximize clergy
+			auto cfrac = state.world.state_instance_get_demographics(ordered_states[i], demographics::to_key(state, state.culture_definitions.clergy)) / state.world.state_instance_get_demographics(ordered_states[i], demographics::total);
+			if(cfrac < base_opt * 1.2f && !state.world.province_get_is_colonial(state.world.state_instance_get_capital(ordered_states[i]))) {
+				auto nf = state.national_definitions.clergy_focus;
+				auto k = state.world.national_focus_get_limit(nf);
+				if(!k || trigger::evaluate(state, k, trigger::to_generic(prov), trigger::to_generic(n), -1)) {
+					assert(command::can_set_national_focus(state, n, ordered_states[i], nf));
+					intents.push_back(ai_focus_intent{ ordered_states[i], state.national_definitions.clergy_focus });
+					--num_focuses_total;
+				}
+			}
 		}
+	}
 
-		for(uint32_t i = 0; num_focuses_total > 0 && i < ordered_states.size(); ++i) {
-			auto prov = state.world.state_instance_get_capital(ordered_states[i]);
+	for(uint32_t i = 0; num_focuses_total > 0 && i < ordered_states.size(); ++i) {
+		auto prov = state.world.state_instance_get_capital(ordered_states[i]);
 
-			if(state.world.province_get_is_colonial(state.world.state_instance_get_capital(ordered_states[i]))) {
-				continue;
-			}
+		if(state.world.province_get_is_colonial(state.world.state_instance_get_capital(ordered_states[i]))) {
+			continue;
+		}
 
-			auto total = state.world.state_instance_get_demographics(ordered_states[i], demographics::total);
-			auto pw_num = state.world.state_instance_get_demographics(ordered_states[i], demographics::to_key(state, state.culture_definitions.primary_factory_worker));
-			auto pw_employed = state.world.state_instance_get_demographics(ordered_states[i], demographics::to_employment_key(state, state.culture_definitions.primary_factory_worker));
-			auto sw_num = state.world.state_instance_get_demographics(ordered_states[i], demographics::to_key(state, state.culture_definitions.secondary_factory_worker));
-			auto sw_employed = state.world.state_instance_get_demographics(ordered_states[i], demographics::to_employment_key(state, state.culture_definitions.secondary_factory_worker));
-			auto sw_frac = sw_num / std::max(pw_num + sw_num, 1.0f);
-			auto ideal_swfrac = (1.f - state.economy_definitions.craftsmen_fraction);
-			// Due to floating point comparison where 2.9999 != 3, we will round the number
-			// so that the ratio is NOT exact, but rather an aproximate
-			if((pw_employed >= pw_num || pw_num < 1.0f)) {
-				auto nf = state.national_definitions.primary_factory_worker_focus;
+		auto total = state.world.state_instance_get_demographics(ordered_states[i], demographics::total);
+		auto pw_num = state.world.state_instance_get_demographics(ordered_states[i], demographics::to_key(state, state.culture_definitions.primary_factory_worker));
+		auto pw_employed = state.world.state_instance_get_demographics(ordered_states[i], demographics::to_employment_key(state, state.culture_definitions.primary_factory_worker));
+		auto sw_num = state.world.state_instance_get_demographics(ordered_states[i], demographics::to_key(state, state.culture_definitions.secondary_factory_worker));
+		auto sw_employed = state.world.state_instance_get_demographics(ordered_states[i], demographics::to_employment_key(state, state.culture_definitions.secondary_factory_worker));
+		auto sw_frac = sw_num / std::max(pw_num + sw_num, 1.0f);
+		auto ideal_swfrac = (1.f - state.economy_definitions.craftsmen_fraction);
+		// Due to floating point comparison where 2.9999 != 3, we will round the number
+		// so that the ratio is NOT exact, but rather an aproximate
+		if((pw_employed >= pw_num || pw_num < 1.0f)) {
+			auto nf = state.national_definitions.primary_factory_worker_focus;
+			auto k = state.world.national_focus_get_limit(nf);
+			if(!k || trigger::evaluate(state, k, trigger::to_generic(prov), trigger::to_generic(n), -1)) {
+				// Keep balance between ratio of factory workers
+				// we will only promote secondary workers if none are unemployed
+				assert(command::can_set_national_focus(state, n, ordered_states[i], nf));
+				intents.push_back(ai_focus_intent{ ordered_states[i], nf });
+				--num_focuses_total;
+			}
+		} else if(pw_num > 1.0f && pw_employed > 1.0f && int8_t(sw_frac * 100.f) != int8_t(ideal_swfrac * 100.f)) {
+			auto nf = state.national_definitions.secondary_factory_worker_focus;
+			auto k = state.world.national_focus_get_limit(nf);
+			if(!k || trigger::evaluate(state, k, trigger::to_generic(prov), trigger::to_generic(n), -1)) {
+				// Keep balance between ratio of factory workers
+				// we will only promote primary workers if none are unemployed
+				assert(command::can_set_national_focus(state, n, ordered_states[i], nf));
+				intents.push_back(ai_focus_intent{ ordered_states[i], nf });
+				--num_focuses_total;
+			}
+		} else {
+			/* If we are a civilized nation, and we allow pops to operate on the economy
+			   i.e Laissez faire, we WILL promote capitalists, since they will help to
+			   build new factories for us */
+			auto rules = n.get_combined_issue_rules();
+			if(n.get_is_civilized() && (rules & (issue_rule::pop_build_factory | issue_rule::pop_build_factory_invest | issue_rule::pop_expand_factory | issue_rule::pop_expand_factory_invest | issue_rule::pop_open_factory | issue_rule::pop_open_factory_invest)) != 0) {
+				auto nf = state.national_definitions.capitalist_focus;
 				auto k = state.world.national_focus_get_limit(nf);
 				if(!k || trigger::evaluate(state, k, trigger::to_generic(prov), trigger::to_generic(n), -1)) {
-					// Keep balance between ratio of factory workers
-					// we will only promote secondary workers if none are unemployed
 					assert(command::can_set_national_focus(state, n, ordered_states[i], nf));
-					state.world.state_instance_set_owner_focus(ordered_states[i], nf);
+					intents.push_back(ai_focus_intent{ ordered_states[i], nf });
 					--num_focuses_total;
 				}
-			} else if(pw_num > 1.0f && pw_employed > 1.0f && int8_t(sw_frac * 100.f) != int8_t(ideal_swfrac * 100.f)) {
-				auto nf = state.national_definitions.secondary_factory_worker_focus;
+			} else {
+				auto nf = state.national_definitions.aristocrat_focus;
 				auto k = state.world.national_focus_get_limit(nf);
 				if(!k || trigger::evaluate(state, k, trigger::to_generic(prov), trigger::to_generic(n), -1)) {
-					// Keep balance between ratio of factory workers
-					// we will only promote primary workers if none are unemployed
 					assert(command::can_set_national_focus(state, n, ordered_states[i], nf));
-					state.world.state_instance_set_owner_focus(ordered_states[i], nf);
+					intents.push_back(ai_focus_intent{ ordered_states[i], nf });
 					--num_focuses_total;
 				}
-			} else {
-				/* If we are a civilized nation, and we allow pops to operate on the economy
-				   i.e Laissez faire, we WILL promote capitalists, since they will help to
-				   build new factories for us */
-				auto rules = n.get_combined_issue_rules();
-				if(n.get_is_civilized() && (rules & (issue_rule::pop_build_factory | issue_rule::pop_build_factory_invest | issue_rule::pop_expand_factory | issue_rule::pop_expand_factory_invest | issue_rule::pop_open_factory | issue_rule::pop_open_factory_invest)) != 0) {
-					auto nf = state.national_definitions.capitalist_focus;
-					auto k = state.world.national_focus_get_limit(nf);
-					if(!k || trigger::evaluate(state, k, trigger::to_generic(prov), trigger::to_generic(n), -1)) {
-						assert(command::can_set_national_focus(state, n, ordered_states[i], nf));
-						state.world.state_instance_set_owner_focus(ordered_states[i], nf);
-						--num_focuses_total;
-					}
-				} else {
-					auto nf = state.national_definitions.aristocrat_focus;
-					auto k = state.world.national_focus_get_limit(nf);
-					if(!k || trigger::evaluate(state, k, trigger::to_generic(prov), trigger::to_generic(n), -1)) {
-						assert(command::can_set_national_focus(state, n, ordered_states[i], nf));
-						state.world.state_instance_set_owner_focus(ordered_states[i], nf);
-						--num_focuses_total;
-					}
-				}
 			}
 		}
 	}
 }
 
+void update_focuses(sys::state& state) {
+	for(auto si : state.world.in_state_instance) {
+		if(!si.get_nation_from_state_ownership().get_is_player_controlled())
+			si.set_owner_focus(dcon::national_focus_id{});
+	}
+
+	static std::vector<std::vector<ai_focus_intent>> intents;
+	intents.resize(state.world.nation_size());
+
+	concurrency::parallel_for(uint32_t(0), state.world.nation_size(), [&](uint32_t i) {
+		intents[i].clear();
+		decide_focuses(state, dcon::nation_id{ dcon::nation_id::value_base_t(i) }, intents[i]);
+	});
+
+	for(auto n : state.world.in_nation) {
+		if(n.get_is_player_controlled())
+			continue;
+		if(n.get_owned_province_count() == 0)
+			continue;
+
+		n.set_state_from_flashpoint_focus(dcon::state_instance_id{});
+		for(auto& f : intents[n.id.index()]) {
+			state.world.state_instance_set_owner_focus(f.state, f.focus);
+		}
+	}
+}
+
 void take_ai_decisions(sys::state& state) {
 	using decision_nation_pair = std::pair<dcon::decision_id, dcon::nation_id>;
 	concurrency::combinable<std::vector<decision_nation_pair, dcon::cache_aligned_allocator<decision_nation_pair>>> decisions_taken;
@@ -1341,171 +1365,73 @@ int16_t calculate_desired_army_size(sys::state& state, dcon::nation_id nation) {
 	return int16_t(std::clamp(total * double(factor), 0.1 * fid.get_recruitable_regiments(), 1.0 * fid.get_recruitable_regiments()));
 }
 
-void update_ai_econ_construction(sys::state& state) {
-	for(auto n : state.world.in_nation) {
-		// skip over: non ais, dead nations, and nations that aren't making money
-		if(n.get_owned_province_count() == 0 || !n.get_is_civilized())
-			continue;
-
-		if(n.get_is_player_controlled()) {
-			// to handle the logic of player building automation later
-			continue;
-		}
-
-		/*
-		if(n.get_spending_level() < 1.0f || n.get_last_treasury() >= n.get_stockpiles(economy::money))
-			continue;
-		*/
-
-		float treasury = n.get_stockpiles(economy::money);
-		float base_income = economy::estimate_daily_income(state, n);
-		float estimated_construction_costs = economy::estimate_construction_spending_from_budget(state, n, std::max(treasury, 1'000'000'000'000.f));
-
-		//if our army is too small, ignore buildings:
-		if(calculate_desired_army_size(state, n) * 0.4f > n.get_active_regiments())
-			continue;
-
-		float budget = treasury * 0.5f + base_income - estimated_construction_costs * 2.f;
-		float additional_expenses = 0.f;
-		float days_prepaid = 10.f;
-		auto rules = n.get_combined_issue_rules();
-
-		if(budget < 0.f) {
-			continue;
-		}
-
-		if((rules & issue_rule::expand_factory) != 0 || (rules & issue_rule::build_factory) != 0) {
-			// prepare a list of states
-			static std::vector<dcon::state_instance_id> ordered_states;
-			ordered_states.clear();
-			for(auto si : n.get_state_ownership()) {
-				if(si.get_state().get_capital().get_is_colonial() == false)
-					ordered_states.push_back(si.get_state().id);
-			}
-			std::sort(ordered_states.begin(), ordered_states.end(), [&](auto a, auto b) {
-				auto apop = state.world.state_instance_get_demographics(a, demographics::total);
-				auto bpop = state.world.state_instance_get_demographics(b, demographics::total);
-				if(apop != bpop)
-					return apop > bpop;
-				else
-					return a.index() < b.index();
-			});
-
-			// try to build
-			static::std::vector<dcon::factory_type_id> craved_types;
-
-			// desired types filled: try to construct or upgrade
-			if(!craved_types.empty()) {
-				if((rules & issue_rule::build_factory) == 0 && (rules & issue_rule::expand_factory) != 0) { // can't build -- by elimination, can upgrade
-
-				} else if((rules & issue_rule::build_factory) != 0) { // -- i.e. if building is possible
-					for(auto si : ordered_states) {
-
-						auto market = state.world.state_instance_get_market_from_local_market(si);
-
-						if(budget - additional_expenses <= 0.f)
-							break;
-
-						auto m = state.world.state_instance_get_market_from_local_market(si);
-						craved_types.clear();
-						get_state_craved_factory_types(state, n, m, craved_types);
-
-						// check -- either unemployed factory workers or no factory workers
-						auto pw_num = state.world.state_instance_get_demographics(si,
-								demographics::to_key(state, state.culture_definitions.primary_factory_worker));
-						pw_num += state.world.state_instance_get_demographics(si,
-								demographics::to_key(state, state.culture_definitions.secondary_factory_worker));
-						auto pw_employed = state.world.state_instance_get_demographics(si,
-								demographics::to_employment_key(state, state.culture_definitions.primary_factory_worker));
-						pw_employed += state.world.state_instance_get_demographics(si,
-								demographics::to_employment_key(state, state.culture_definitions.secondary_factory_worker));
-
-						if(pw_employed >= float(pw_num) * 2.5f && pw_num > 0.0f)
-							continue; // no spare workers
+struct ai_construction_intent {
+	dcon::state_instance_id state; // factory projects
+	dcon::province_id province; // province building projects
+	dcon::factory_type_id factory_type;
+	uint8_t building_type = 0;
+	bool is_upgrade = false;
+};
 
-						auto type_selection = craved_types[rng::get_random(state, uint32_t(n.id.index() + int32_t(budget))) % craved_types.size()];
-						assert(type_selection);
+// decides which projects the nation should start, without starting them; only reads the game state so that it can run for all nations at once
+static void decide_ai_econ_construction(sys::state& state, dcon::nation_id nid, std::vector<ai_construction_intent>& intents) {
+	auto n = fatten(state.world, nid);
 
-						if(state.world.factory_type_get_is_coastal(type_selection) && !province::state_is_coastal(state, si))
-							continue;
+	// skip over: non ais, dead nations, and nations that aren't making money
+	if(n.get_owned_province_count() == 0 || !n.get_is_civilized())
+		return;
 
-						bool already_in_progress = [&]() {
-							for(auto p : state.world.state_instance_get_state_building_construction(si)) {
-								if(p.get_type() == type_selection)
-									return true;
-							}
-							return false;
-							}();
+	if(n.get_is_player_controlled()) {
+		// to handle the logic of player building automation later
+		return;
+	}
 
-							if(already_in_progress)
-								continue;
+	/*
+	if(n.get_spending_level() < 1.0f || n.get_last_treasury() >= n.get_stockpiles(economy::money))
+		return;
+	*/
 
-							// check: if present, try to upgrade
-							bool present_in_location = false;
-							bool under_cap = false;
+	float treasury = n.get_stockpiles(economy::money);
+	float base_income = economy::estimate_daily_income(state, n);
+	float estimated_construction_costs = economy::estimate_construction_spending_from_budget(state, n, std::max(treasury, 1'000'000'000'000.f));
 
-							province::for_each_province_in_state_instance(state, si, [&](dcon::province_id p) {
-								for(auto fac : state.world.province_get_factory_location(p)) {
-									auto type = fac.get_factory().get_building_type();
-									if(type_selection == type) {
-										under_cap = fac.get_factory().get_primary_employment() * state.world.market_get_labor_unskilled_demand_satisfaction(market) < 0.9f;
-										present_in_location = true;
-										return;
-									}
-								}
-							});
-							if(under_cap) {
-								continue; // factory doesn't need to get larger
-							}
+	//if our army is too small, ignore buildings:
+	if(calculate_desired_army_size(state, n) * 0.4f > n.get_active_regiments())
+		return;
 
-							auto expected_item_cost = 0.f;
-							auto costs = state.world.factory_type_get_construction_costs(type_selection);
-							auto time = state.world.factory_type_get_construction_time(type_selection);
-							for(uint32_t i = 0; i < costs.set_size; ++i) {
-								if(costs.commodity_type[i]) {
-									expected_item_cost +=
-										costs.commodity_amounts[i]
-										* economy::price(state, market, costs.commodity_type[i])
-										/ float(time)
-										* days_prepaid;
-								} else {
-									break;
-								}
-							}
+	float budget = treasury * 0.5f + base_income - estimated_construction_costs * 2.f;
+	float additional_expenses = 0.f;
+	float days_prepaid = 10.f;
+	auto rules = n.get_combined_issue_rules();
 
-							if(budget - additional_expenses - expected_item_cost <= 0.f)
-								continue;
+	if(budget < 0.f) {
+		return;
+	}
 
-							if(present_in_location) {
-								if((rules & issue_rule::expand_factory) != 0) {
-									auto new_up = fatten(state.world, state.world.force_create_state_building_construction(si, n));
-									new_up.set_is_pop_project(false);
-									new_up.set_is_upgrade(true);
-									new_up.set_type(type_selection);
+	if((rules & issue_rule::expand_factory) != 0 || (rules & issue_rule::build_factory) != 0) {
+		// prepare a list of states
+		std::vector<dcon::state_instance_id> ordered_states;
+		for(auto si : n.get_state_ownership()) {
+			if(si.get_state().get_capital().get_is_colonial() == false)
+				ordered_states.push_back(si.get_state().id);
+		}
+		std::sort(ordered_states.begin(), ordered_states.end(), [&](auto a, auto b) {
+			auto apop = state.world.state_instance_get_demographics(a, demographics::total);
+			auto bpop = state.world.state_instance_get_demographics(b, demographics::total);
+			if(apop != bpop)
+				return apop > bpop;
+			else
+				return a.index() < b.index();
+		});
 
-									additional_expenses += expected_item_cost;
-								}
-								continue;
-							}
+		// try to build
+		std::vector<dcon::factory_type_id> craved_types;
 
-							// else -- try to build -- must have room
-							int32_t num_factories = economy::state_factory_count(state, si, n);
-							if(num_factories < int32_t(state.defines.factories_per_state)) {
-								auto new_up = fatten(state.world, state.world.force_create_state_building_construction(si, n));
-								new_up.set_is_pop_project(false);
-								new_up.set_is_upgrade(false);
-								new_up.set_type(type_selection);
-								additional_expenses += expected_item_cost;
-								continue;
-							} else {
-								// TODO: try to delete a factory here
-							}
-					} // END for(auto si : ordered_states) {
-				} // END if((rules & issue_rule::build_factory) == 0)
-			} // END if(!desired_types.empty()) {
+		// desired types filled: try to construct or upgrade
+		if(!craved_types.empty()) {
+			if((rules & issue_rule::build_factory) == 0 && (rules & issue_rule::expand_factory) != 0) { // can't build -- by elimination, can upgrade
 
-			// try to upgrade factories first:
-			if((rules & issue_rule::expand_factory) != 0) { // can't build -- by elimination, can upgrade
+			} else if((rules & issue_rule::build_factory) != 0) { // -- i.e. if building is possible
 				for(auto si : ordered_states) {
 
 					auto market = state.world.state_instance_get_market_from_local_market(si);
@@ -1513,101 +1439,39 @@ void update_ai_econ_construction(sys::state& state) {
 					if(budget - additional_expenses <= 0.f)
 						break;
 
-					province::for_each_province_in_state_instance(state, si, [&](dcon::province_id p) {
-						for(auto fac : state.world.province_get_factory_location(p)) {
-							auto type = fac.get_factory().get_building_type();
+					auto m = state.world.state_instance_get_market_from_local_market(si);
+					craved_types.clear();
+					get_state_craved_factory_types(state, n, m, craved_types);
 
+					// check -- either unemployed factory workers or no factory workers
+					auto pw_num = state.world.state_instance_get_demographics(si,
+							demographics::to_key(state, state.culture_definitions.primary_factory_worker));
+					pw_num += state.world.state_instance_get_demographics(si,
+							demographics::to_key(state, state.culture_definitions.secondary_factory_worker));
+					auto pw_employed = state.world.state_instance_get_demographics(si,
+							demographics::to_employment_key(state, state.culture_definitions.primary_factory_worker));
+					pw_employed += state.world.state_instance_get_demographics(si,
+							demographics::to_employment_key(state, state.culture_definitions.secondary_factory_worker));
 
-							auto unprofitable = fac.get_factory().get_unprofitable();
-							auto factory_level = fac.get_factory().get_level();
-							auto primary_employment = fac.get_factory().get_primary_employment() * state.world.market_get_labor_unskilled_demand_satisfaction(market);
+					if(pw_employed >= float(pw_num) * 2.5f && pw_num > 0.0f)
+						continue; // no spare workers
 
-							if(!unprofitable && factory_level < uint8_t(255) && primary_employment >= 0.9f) {
-								// test if factory is already upgrading
-								auto ug_in_progress = false;
-								for(auto c : state.world.state_instance_get_state_building_construction(si)) {
-									if(c.get_type() == type) {
-										ug_in_progress = true;
-										break;
-									}
-								}
+					auto type_selection = craved_types[rng::get_random(state, uint32_t(n.id.index() + int32_t(budget))) % craved_types.size()];
+					assert(type_selection);
 
-								auto expected_item_cost = 0.f;
-								auto& costs = state.world.factory_type_get_construction_costs(type);
-								auto& time = state.world.factory_type_get_construction_time(type);
-								for(uint32_t i = 0; i < costs.set_size; ++i) {
-									if(costs.commodity_type[i]) {
-										expected_item_cost +=
-											costs.commodity_amounts[i]
-											* economy::price(state, market, costs.commodity_type[i])
-											/ float(time)
-											* days_prepaid;
-									} else {
-										break;
-									}
-								}
-
-								if(budget - additional_expenses - expected_item_cost <= 0.f)
-									continue;
-
-								if(!ug_in_progress) {
-									auto new_up = fatten(state.world, state.world.force_create_state_building_construction(si, n));
-									new_up.set_is_pop_project(false);
-									new_up.set_is_upgrade(true);
-									new_up.set_type(type);
+					if(state.world.factory_type_get_is_coastal(type_selection) && !province::state_is_coastal(state, si))
+						continue;
 
-									additional_expenses += expected_item_cost;
-								}
-							}
+					bool already_in_progress = [&]() {
+						for(auto p : state.world.state_instance_get_state_building_construction(si)) {
+							if(p.get_type() == type_selection)
+								return true;
 						}
-					});
-				}
-			}
-
-			// try to build
-			static::std::vector<dcon::factory_type_id> desired_types;
-
-			// desired types filled: try to construct or upgrade
-			if(!desired_types.empty()) {				
-				if((rules & issue_rule::build_factory) == 0 && (rules & issue_rule::expand_factory) != 0) { // can't build -- by elimination, can upgrade
-					
-				} else if((rules & issue_rule::build_factory) != 0) { // -- i.e. if building is possible
-					for(auto si : ordered_states) {
-
-						auto market = state.world.state_instance_get_market_from_local_market(si);
-
-						if(budget - additional_expenses <= 0.f)
-							break;
-
-						auto m = state.world.state_instance_get_market_from_local_market(si);
-						desired_types.clear();
-						get_state_desired_factory_types(state, n, m, desired_types);
-
-						// check -- either unemployed factory workers or no factory workers
-						auto pw_num = state.world.state_instance_get_demographics(si,
-								demographics::to_key(state, state.culture_definitions.primary_factory_worker));
-						pw_num += state.world.state_instance_get_demographics(si,
-								demographics::to_key(state, state.culture_definitions.secondary_factory_worker));
-						auto pw_employed = state.world.state_instance_get_demographics(si,
-								demographics::to_employment_key(state, state.culture_definitions.primary_factory_worker));
-						pw_employed += state.world.state_instance_get_demographics(si,
-								demographics::to_employment_key(state, state.culture_definitions.secondary_factory_worker));
-
-						if(pw_employed >= float(pw_num) * 2.5f && pw_num > 0.0f)
-							continue; // no spare workers
-
-						auto type_selection = desired_types[rng::get_random(state, uint32_t(n.id.index() + int32_t(budget))) % desired_types.size()];
-						assert(type_selection);
-
-						if(state.world.factory_type_get_is_coastal(type_selection) && !province::state_is_coastal(state, si))
-							continue;
-
-						bool already_in_progress = [&]() {
-							for(auto p : state.world.state_instance_get_state_building_construction(si)) {
-								if(p.get_type() == type_selection)
-									return true;
-							}
-							return false;
+						for(auto& i : intents) {
+							if(i.state == si && i.factory_type == type_selection)
+								return true;
+						}
+						return false;
 						}();
 
 						if(already_in_progress)
@@ -1651,10 +1515,7 @@ void update_ai_econ_construction(sys::state& state) {
 
 						if(present_in_location) {
 							if((rules & issue_rule::expand_factory) != 0) {
-								auto new_up = fatten(state.world, state.world.force_create_state_building_construction(si, n));
-								new_up.set_is_pop_project(false);
-								new_up.set_is_upgrade(true);
-								new_up.set_type(type_selection);
+								intents.push_back(ai_construction_intent{ si, dcon::province_id{}, type_selection, uint8_t(0), true });
 
 								additional_expenses += expected_item_cost;
 							}
@@ -1663,145 +1524,163 @@ void update_ai_econ_construction(sys::state& state) {
 
 						// else -- try to build -- must have room
 						int32_t num_factories = economy::state_factory_count(state, si, n);
+						for(auto& i : intents) {
+							if(i.state == si && !i.is_upgrade)
+								++num_factories;
+						}
 						if(num_factories < int32_t(state.defines.factories_per_state)) {
-							auto new_up = fatten(state.world, state.world.force_create_state_building_construction(si, n));
-							new_up.set_is_pop_project(false);
-							new_up.set_is_upgrade(false);
-							new_up.set_type(type_selection);
+							intents.push_back(ai_construction_intent{ si, dcon::province_id{}, type_selection, uint8_t(0), false });
 							additional_expenses += expected_item_cost;
 							continue;
 						} else {
 							// TODO: try to delete a factory here
 						}
-					} // END for(auto si : ordered_states) {
-				} // END if((rules & issue_rule::build_factory) == 0)
-			} // END if(!desired_types.empty()) {
-		} // END  if((rules & issue_rule::expand_factory) != 0 || (rules & issue_rule::build_factory) != 0)
+				} // END for(auto si : ordered_states) {
+			} // END if((rules & issue_rule::build_factory) == 0)
+		} // END if(!desired_types.empty()) {
 
-		if(0.9f * n.get_recruitable_regiments() > n.get_active_regiments())
-			continue;
+		// try to upgrade factories first:
+		if((rules & issue_rule::expand_factory) != 0) { // can't build -- by elimination, can upgrade
+			for(auto si : ordered_states) {
 
-		static std::vector<dcon::province_id> project_provs;
-		project_provs.clear();
+				auto market = state.world.state_instance_get_market_from_local_market(si);
 
-		// try naval bases
-		if(budget - additional_expenses >= 0.f) {
-			project_provs.clear();
-			for(auto o : n.get_province_ownership()) {
-				if(!o.get_province().get_is_coast())
-					continue;
-				if(n != o.get_province().get_nation_from_province_control())
-					continue;				
+				if(budget - additional_expenses <= 0.f)
+					break;
 
-				if(military::province_is_under_siege(state, o.get_province()))
-					continue;
-				if(o.get_province().get_building_level(uint8_t(economy::province_building_type::naval_base)) == 0 && o.get_province().get_state_membership().get_naval_base_is_taken())
-					continue;
+				province::for_each_province_in_state_instance(state, si, [&](dcon::province_id p) {
+					for(auto fac : state.world.province_get_factory_location(p)) {
+						auto type = fac.get_factory().get_building_type();
 
-				int32_t current_lvl = o.get_province().get_building_level(uint8_t(economy::province_building_type::naval_base));
-				int32_t max_local_lvl = n.get_max_building_level(uint8_t(economy::province_building_type::naval_base));
-				int32_t min_build = int32_t(o.get_province().get_modifier_values(sys::provincial_mod_offsets::min_build_naval_base));
 
-				if(max_local_lvl - current_lvl - min_build <= 0)
-					continue;
+						auto unprofitable = fac.get_factory().get_unprofitable();
+						auto factory_level = fac.get_factory().get_level();
+						auto primary_employment = fac.get_factory().get_primary_employment() * state.world.market_get_labor_unskilled_demand_satisfaction(market);
 
-				if(!province::has_naval_base_being_built(state, o.get_province())) {
-					project_provs.push_back(o.get_province().id);
-				}
+						if(!unprofitable && factory_level < uint8_t(255) && primary_employment >= 0.9f) {
+							// test if factory is already upgrading
+							auto ug_in_progress = false;
+							for(auto c : state.world.state_instance_get_state_building_construction(si)) {
+								if(c.get_type() == type) {
+									ug_in_progress = true;
+									break;
+								}
+							}
+							for(auto& i : intents) {
+								if(i.state == si && i.factory_type == type) {
+									ug_in_progress = true;
+									break;
+								}
+							}
+
+							auto expected_item_cost = 0.f;
+							auto& costs = state.world.factory_type_get_construction_costs(type);
+							auto& time = state.world.factory_type_get_construction_time(type);
+							for(uint32_t i = 0; i < costs.set_size; ++i) {
+								if(costs.commodity_type[i]) {
+									expected_item_cost +=
+										costs.commodity_amounts[i]
+										* economy::price(state, market, costs.commodity_type[i])
+										/ float(time)
+										* days_prepaid;
+								} else {
+									break;
+								}
+							}
+
+							if(budget - additional_expenses - expected_item_cost <= 0.f)
+								continue;
+
+							if(!ug_in_progress) {
+								intents.push_back(ai_construction_intent{ si, dcon::province_id{}, type, uint8_t(0), true });
+
+								additional_expenses += expected_item_cost;
+							}
+						}
+					}
+				});
 			}
+		}
 
-			auto cap = n.get_capital();
-			std::sort(project_provs.begin(), project_provs.end(), [&](dcon::province_id a, dcon::province_id b) {
-				auto a_dist = province::sorting_distance(state, a, cap);
-				auto b_dist = province::sorting_distance(state, b, cap);
-				if(a_dist != b_dist)
-					return a_dist < b_dist;
-				else
-					return a.index() < b.index();
-			});
-			if(!project_provs.empty()) {
-				auto si = state.world.province_get_state_membership(project_provs[0]);
-				auto market = state.world.state_instance_get_market_from_local_market(si);
+		// try to build
+		std::vector<dcon::factory_type_id> desired_types;
 
-				// avoid overbuilding!
+		// desired types filled: try to construct or upgrade
+		if(!desired_types.empty()) {				
+			if((rules & issue_rule::build_factory) == 0 && (rules & issue_rule::expand_factory) != 0) { // can't build -- by elimination, can upgrade
+				
+			} else if((rules & issue_rule::build_factory) != 0) { // -- i.e. if building is possible
+				for(auto si : ordered_states) {
 
-				auto expected_item_cost = 0.f;
-				auto& costs = state.economy_definitions.building_definitions[int32_t(economy::province_building_type::naval_base)].cost;
-				auto& time = state.economy_definitions.building_definitions[int32_t(economy::province_building_type::naval_base)].time;
-				for(uint32_t i = 0; i < costs.set_size; ++i) {
-					if(costs.commodity_type[i]) {
-						expected_item_cost +=
-							costs.commodity_amounts[i]
-							* economy::price(state, market, costs.commodity_type[i])
-							/ float(time)
-							* days_prepaid;
-					} else {
+					auto market = state.world.state_instance_get_market_from_local_market(si);
+
+					if(budget - additional_expenses <= 0.f)
 						break;
-					}
-				}
 
-				if(budget - additional_expenses - expected_item_cost <= 0.f)
-					continue;
+					auto m = state.world.state_instance_get_market_from_local_market(si);
+					desired_types.clear();
+					get_state_desired_factory_types(state, n, m, desired_types);
 
-				if(si)
-					si.set_naval_base_is_taken(true);
-				auto new_rr = fatten(state.world, state.world.force_create_province_building_construction(project_provs[0], n));
-				new_rr.set_is_pop_project(false);
-				new_rr.set_type(uint8_t(economy::province_building_type::naval_base));
-				additional_expenses += expected_item_cost;
-			}
-		}
+					// check -- either unemployed factory workers or no factory workers
+					auto pw_num = state.world.state_instance_get_demographics(si,
+							demographics::to_key(state, state.culture_definitions.primary_factory_worker));
+					pw_num += state.world.state_instance_get_demographics(si,
+							demographics::to_key(state, state.culture_definitions.secondary_factory_worker));
+					auto pw_employed = state.world.state_instance_get_demographics(si,
+							demographics::to_employment_key(state, state.culture_definitions.primary_factory_worker));
+					pw_employed += state.world.state_instance_get_demographics(si,
+							demographics::to_employment_key(state, state.culture_definitions.secondary_factory_worker));
 
-		// try railroads
-		const struct {
-			bool buildable;
-			economy::province_building_type type;
-			dcon::provincial_modifier_value mod;
-		} econ_buildable[3] = {
-			{ (rules & issue_rule::build_railway) != 0, economy::province_building_type::railroad, sys::provincial_mod_offsets::min_build_railroad },
-			{ (rules & issue_rule::build_bank) != 0 && state.economy_definitions.building_definitions[uint32_t(economy::province_building_type::bank)].defined, economy::province_building_type::bank, sys::provincial_mod_offsets::min_build_bank },
-			{ (rules & issue_rule::build_university) != 0 && state.economy_definitions.building_definitions[uint32_t(economy::province_building_type::university)].defined, economy::province_building_type::university, sys::provincial_mod_offsets::min_build_university }
-		};
-		for(auto i = 0; i < 3; i++) {
-			if(econ_buildable[i].buildable && budget - additional_expenses > 0) {
-				project_provs.clear();
-				for(auto o : n.get_province_ownership()) {
-					if(n != o.get_province().get_nation_from_province_control())
-						continue;
-					if(military::province_is_under_siege(state, o.get_province()))
+					if(pw_employed >= float(pw_num) * 2.5f && pw_num > 0.0f)
+						continue; // no spare workers
+
+					auto type_selection = desired_types[rng::get_random(state, uint32_t(n.id.index() + int32_t(budget))) % desired_types.size()];
+					assert(type_selection);
+
+					if(state.world.factory_type_get_is_coastal(type_selection) && !province::state_is_coastal(state, si))
 						continue;
-					int32_t current_lvl = state.world.province_get_building_level(o.get_province(), uint8_t(econ_buildable[i].type));
-					int32_t max_local_lvl = state.world.nation_get_max_building_level(n, uint8_t(econ_buildable[i].type));
-					int32_t min_build = int32_t(state.world.province_get_modifier_values(o.get_province(), econ_buildable[i].mod));
-					if(max_local_lvl - current_lvl - min_build <= 0)
+
+					bool already_in_progress = [&]() {
+						for(auto p : state.world.state_instance_get_state_building_construction(si)) {
+							if(p.get_type() == type_selection)
+								return true;
+						}
+						for(auto& i : intents) {
+							if(i.state == si && i.factory_type == type_selection)
+								return true;
+						}
+						return false;
+					}();
+
+					if(already_in_progress)
 						continue;
-					if(!province::has_province_building_being_built(state, o.get_province(), econ_buildable[i].type)) {
-						project_provs.push_back(o.get_province().id);
-					}
-				}
-				auto cap = n.get_capital();
-				std::sort(project_provs.begin(), project_provs.end(), [&](dcon::province_id a, dcon::province_id b) {
-					auto a_dist = province::sorting_distance(state, a, cap);
-					auto b_dist = province::sorting_distance(state, b, cap);
-					if(a_dist != b_dist)
-						return a_dist < b_dist;
-					else
-						return a.index() < b.index();
-				});
-				for(uint32_t j = 0; j < project_provs.size() && budget - additional_expenses > 0; ++j) {
-					auto sid = state.world.province_get_state_membership(project_provs[j]);
-					auto market = state.world.state_instance_get_market_from_local_market(sid);
 
-					// avoid overbuilding!
+					// check: if present, try to upgrade
+					bool present_in_location = false;
+					bool under_cap = false;
+
+					province::for_each_province_in_state_instance(state, si, [&](dcon::province_id p) {
+						for(auto fac : state.world.province_get_factory_location(p)) {
+							auto type = fac.get_factory().get_building_type();
+							if(type_selection == type) {
+								under_cap = fac.get_factory().get_primary_employment() * state.world.market_get_labor_unskilled_demand_satisfaction(market) < 0.9f;
+								present_in_location = true;
+								return;
+							}
+						}
+					});
+					if(under_cap) {
+						continue; // factory doesn't need to get larger
+					}
 
 					auto expected_item_cost = 0.f;
-					auto& costs = state.economy_definitions.building_definitions[uint8_t(econ_buildable[i].type)].cost;
-					auto& time = state.economy_definitions.building_definitions[uint8_t(econ_buildable[i].type)].time;
-					for(uint32_t k = 0; k < costs.set_size; ++k) {
-						if(costs.commodity_type[k]) {
+					auto costs = state.world.factory_type_get_construction_costs(type_selection);
+					auto time = state.world.factory_type_get_construction_time(type_selection);
+					for(uint32_t i = 0; i < costs.set_size; ++i) {
+						if(costs.commodity_type[i]) {
 							expected_item_cost +=
-								costs.commodity_amounts[k]
-								* economy::price(state, market, costs.commodity_type[k])
+								costs.commodity_amounts[i]
+								* economy::price(state, market, costs.commodity_type[i])
 								/ float(time)
 								* days_prepaid;
 						} else {
@@ -1812,40 +1691,129 @@ void update_ai_econ_construction(sys::state& state) {
 					if(budget - additional_expenses - expected_item_cost <= 0.f)
 						continue;
 
-					auto new_proj = fatten(state.world, state.world.force_create_province_building_construction(project_provs[j], n));
-					new_proj.set_is_pop_project(false);
-					new_proj.set_type(uint8_t(econ_buildable[i].type));
-					additional_expenses += expected_item_cost;
-				}
+					if(present_in_location) {
+						if((rules & issue_rule::expand_factory) != 0) {
+							intents.push_back(ai_construction_intent{ si, dcon::province_id{}, type_selection, uint8_t(0), true });
+
+							additional_expenses += expected_item_cost;
+						}
+						continue;
+					}
+
+					// else -- try to build -- must have room
+					int32_t num_factories = economy::state_factory_count(state, si, n);
+					for(auto& i : intents) {
+						if(i.state == si && !i.is_upgrade)
+							++num_factories;
+					}
+					if(num_factories < int32_t(state.defines.factories_per_state)) {
+						intents.push_back(ai_construction_intent{ si, dcon::province_id{}, type_selection, uint8_t(0), false });
+						additional_expenses += expected_item_cost;
+						continue;
+					} else {
+						// TODO: try to delete a factory here
+					}
+				} // END for(auto si : ordered_states) {
+			} // END if((rules & issue_rule::build_factory) == 0)
+		} // END if(!desired_types.empty()) {
+	} // END  if((rules & issue_rule::expand_factory) != 0 || (rules & issue_rule::build_factory) != 0)
+
+	if(0.9f * n.get_recruitable_regiments() > n.get_active_regiments())
+		return;
+
+	std::vector<dcon::province_id> project_provs;
+
+	// try naval bases
+	if(budget - additional_expenses >= 0.f) {
+		project_provs.clear();
+		for(auto o : n.get_province_ownership()) {
+			if(!o.get_province().get_is_coast())
+				continue;
+			if(n != o.get_province().get_nation_from_province_control())
+				continue;				
+
+			if(military::province_is_under_siege(state, o.get_province()))
+				continue;
+			if(o.get_province().get_building_level(uint8_t(economy::province_building_type::naval_base)) == 0 && o.get_province().get_state_membership().get_naval_base_is_taken())
+				continue;
+
+			int32_t current_lvl = o.get_province().get_building_level(uint8_t(economy::province_building_type::naval_base));
+			int32_t max_local_lvl = n.get_max_building_level(uint8_t(economy::province_building_type::naval_base));
+			int32_t min_build = int32_t(o.get_province().get_modifier_values(sys::provincial_mod_offsets::min_build_naval_base));
+
+			if(max_local_lvl - current_lvl - min_build <= 0)
+				continue;
+
+			if(!province::has_naval_base_being_built(state, o.get_province())) {
+				project_provs.push_back(o.get_province().id);
 			}
 		}
 
-		if(0.95f * n.get_recruitable_regiments() > n.get_active_regiments())
-			continue;
+		auto cap = n.get_capital();
+		std::sort(project_provs.begin(), project_provs.end(), [&](dcon::province_id a, dcon::province_id b) {
+			auto a_dist = province::sorting_distance(state, a, cap);
+			auto b_dist = province::sorting_distance(state, b, cap);
+			if(a_dist != b_dist)
+				return a_dist < b_dist;
+			else
+				return a.index() < b.index();
+		});
+		if(!project_provs.empty()) {
+			auto si = state.world.province_get_state_membership(project_provs[0]);
+			auto market = state.world.state_instance_get_market_from_local_market(si);
+
+			// avoid overbuilding!
+
+			auto expected_item_cost = 0.f;
+			auto& costs = state.economy_definitions.building_definitions[int32_t(economy::province_building_type::naval_base)].cost;
+			auto& time = state.economy_definitions.building_definitions[int32_t(economy::province_building_type::naval_base)].time;
+			for(uint32_t i = 0; i < costs.set_size; ++i) {
+				if(costs.commodity_type[i]) {
+					expected_item_cost +=
+						costs.commodity_amounts[i]
+						* economy::price(state, market, costs.commodity_type[i])
+						/ float(time)
+						* days_prepaid;
+				} else {
+					break;
+				}
+			}
 
-		// try forts
-		if(budget - additional_expenses > 0.f) {
-			project_provs.clear();
+			if(budget - additional_expenses - expected_item_cost <= 0.f)
+				return;
 
+			intents.push_back(ai_construction_intent{ dcon::state_instance_id{}, project_provs[0], dcon::factory_type_id{}, uint8_t(economy::province_building_type::naval_base), false });
+			additional_expenses += expected_item_cost;
+		}
+	}
+
+	// try railroads
+	const struct {
+		bool buildable;
+		economy::province_building_type type;
+		dcon::provincial_modifier_value mod;
+	} econ_buildable[3] = {
+		{ (rules & issue_rule::build_railway) != 0, economy::province_building_type::railroad, sys::provincial_mod_offsets::min_build_railroad },
+		{ (rules & issue_rule::build_bank) != 0 && state.economy_definitions.building_definitions[uint32_t(economy::province_building_type::bank)].defined, economy::province_building_type::bank, sys::provincial_mod_offsets::min_build_bank },
+		{ (rules & issue_rule::build_university) != 0 && state.economy_definitions.building_definitions[uint32_t(economy::province_building_type::university)].defined, economy::province_building_type::university, sys::provincial_mod_offsets::min_build_university }
+	};
+	for(auto i = 0; i < 3; i++) {
+		if(econ_buildable[i].buildable && budget - additional_expenses > 0) {
+			project_provs.clear();
 			for(auto o : n.get_province_ownership()) {
 				if(n != o.get_province().get_nation_from_province_control())
 					continue;
-
 				if(military::province_is_under_siege(state, o.get_province()))
 					continue;
-
-				int32_t current_lvl = state.world.province_get_building_level(o.get_province(), uint8_t(economy::province_building_type::fort));
-				int32_t max_local_lvl = state.world.nation_get_max_building_level(n, uint8_t(economy::province_building_type::fort));
-				int32_t min_build = int32_t(state.world.province_get_modifier_values(o.get_province(), sys::provincial_mod_offsets::min_build_fort));
-
+				int32_t current_lvl = state.world.province_get_building_level(o.get_province(), uint8_t(econ_buildable[i].type));
+				int32_t max_local_lvl = state.world.nation_get_max_building_level(n, uint8_t(econ_buildable[i].type));
+				int32_t min_build = int32_t(state.world.province_get_modifier_values(o.get_province(), econ_buildable[i].mod));
 				if(max_local_lvl - current_lvl - min_build <= 0)
 					continue;
-
-				if(!province::has_fort_being_built(state, o.get_province())) {
+				if(!province::has_province_building_being_built(state, o.get_province(), econ_buildable[i].type)) {
 					project_provs.push_back(o.get_province().id);
 				}
 			}
-
 			auto cap = n.get_capital();
 			std::sort(project_provs.begin(), project_provs.end(), [&](dcon::province_id a, dcon::province_id b) {
 				auto a_dist = province::sorting_distance(state, a, cap);
@@ -1855,26 +1823,22 @@ void update_ai_econ_construction(sys::state& state) {
 				else
 					return a.index() < b.index();
 			});
-
-			for(uint32_t i = 0; i < project_provs.size() && budget - additional_expenses > 0.f; ++i) {
-
-				auto sid = state.world.province_get_state_membership(project_provs[i]);
-				auto market = state.world.state_instance_get_market_from_local_market(sid.id);
+			for(uint32_t j = 0; j < project_provs.size() && budget - additional_expenses > 0; ++j) {
+				auto sid = state.world.province_get_state_membership(project_provs[j]);
+				auto market = state.world.state_instance_get_market_from_local_market(sid);
 
 				// avoid overbuilding!
 
 				auto expected_item_cost = 0.f;
-				auto& costs = state.economy_definitions.building_definitions[uint8_t(economy::province_building_type::fort)].cost;
-				auto& time = state.economy_definitions.building_definitions[uint8_t(economy::province_building_type::fort)].time;
+				auto& costs = state.economy_definitions.building_definitions[uint8_t(econ_buildable[i].type)].cost;
+				auto& time = state.economy_definitions.building_definitions[uint8_t(econ_buildable[i].type)].time;
 				for(uint32_t k = 0; k < costs.set_size; ++k) {
 					if(costs.commodity_type[k]) {
 						expected_item_cost +=
 							costs.commodity_amounts[k]
 							* economy::price(state, market, costs.commodity_type[k])
-							* days_prepaid
-							* 100000.f;
-						// forts are very bad investment and demand volatile goods,
-						// so build them if AI is really rich and has no idea where how to spend money
+							/ float(time)
+							* days_prepaid;
 					} else {
 						break;
 					}
@@ -1883,13 +1847,111 @@ void update_ai_econ_construction(sys::state& state) {
 				if(budget - additional_expenses - expected_item_cost <= 0.f)
 					continue;
 
-				auto new_rr = fatten(state.world, state.world.force_create_province_building_construction(project_provs[i], n));
-				new_rr.set_is_pop_project(false);
-				new_rr.set_type(uint8_t(economy::province_building_type::fort));
+				intents.push_back(ai_construction_intent{ dcon::state_instance_id{}, project_provs[j], dcon::factory_type_id{}, uint8_t(econ_buildable[i].type), false });
 				additional_expenses += expected_item_cost;
 			}
 		}
 	}
+
+	if(0.95f * n.get_recruitable_regiments() > n.get_active_regiments())
+		return;
+
+	// try forts
+	if(budget - additional_expenses > 0.f) {
+		project_provs.clear();
+
+		for(auto o : n.get_province_ownership()) {
+			if(n != o.get_province().get_nation_from_province_control())
+				continue;
+
+			if(military::province_is_under_siege(state, o.get_province()))
+				continue;
+
+			int32_t current_lvl = state.world.province_get_building_level(o.get_province(), uint8_t(economy::province_building_type::fort));
+			int32_t max_local_lvl = state.world.nation_get_max_building_level(n, uint8_t(economy::province_building_type::fort));
+			int32_t min_build = int32_t(state.world.province_get_modifier_values(o.get_province(), sys::provincial_mod_offsets::min_build_fort));
+
+			if(max_local_lvl - current_lvl - min_build <= 0)
+				continue;
+
+			if(!province::has_fort_being_built(state, o.get_province())) {
+				project_provs.push_back(o.get_province().id);
+			}
+		}
+
+		auto cap = n.get_capital();
+		std::sort(project_provs.begin(), project_provs.end(), [&](dcon::province_id a, dcon::province_id b) {
+			auto a_dist = province::sorting_distance(state, a, cap);
+			auto b_dist = province::sorting_distance(state, b, cap);
+			if(a_dist != b_dist)
+				return a_dist < b_dist;
+			else
+				return a.index() < b.index();
+		});
+
+		for(uint32_t i = 0; i < project_provs.size() && budget - additional_expenses > 0.f; ++i) {
+
+			auto sid = state.world.province_get_state_membership(project_provs[i]);
+			auto market = state.world.state_instance_get_market_from_local_market(sid.id);
+
+			// avoid overbuilding!
+
+			auto expected_item_cost = 0.f;
+			auto& costs = state.economy_definitions.building_definitions[uint8_t(economy::province_building_type::fort)].cost;
+			auto& time = state.economy_definitions.building_definitions[uint8_t(economy::province_building_type::fort)].time;
+			for(uint32_t k = 0; k < costs.set_size; ++k) {
+				if(costs.commodity_type[k]) {
+					expected_item_cost +=
+						costs.commodity_amounts[k]
+						* economy::price(state, market, costs.commodity_type[k])
+						* days_prepaid
+						* 100000.f;
+					// forts are very bad investment and demand volatile goods,
+					// so build them if AI is really rich and has no idea where how to spend money
+				} else {
+					break;
+				}
+			}
+
+			if(budget - additional_expenses - expected_item_cost <= 0.f)
+				continue;
+
+			intents.push_back(ai_construction_intent{ dcon::state_instance_id{}, project_provs[i], dcon::factory_type_id{}, uint8_t(economy::province_building_type::fort), false });
+			additional_expenses += expected_item_cost;
+		}
+	}
+}
+
+void update_ai_econ_construction(sys::state& state) {
+	static std::vector<std::vector<ai_construction_intent>> intents;
+	intents.resize(state.world.nation_size());
+
+	concurrency::parallel_for(uint32_t(0), state.world.nation_size(), [&](uint32_t i) {
+		intents[i].clear();
+		decide_ai_econ_construction(state, dcon::nation_id{ dcon::nation_id::value_base_t(i) }, intents[i]);
+	});
+
+	// projects are created in nation order, so the ids they receive do not depend on how the decisions were scheduled
+	for(uint32_t i = 0; i < state.world.nation_size(); ++i) {
+		dcon::nation_id n{ dcon::nation_id::value_base_t(i) };
+		for(auto& c : intents[i]) {
+			if(c.province) {
+				if(c.building_type == uint8_t(economy::province_building_type::naval_base)) {
+					auto si = state.world.province_get_state_membership(c.province);
+					if(si)
+						state.world.state_instance_set_naval_base_is_taken(si, true);
+				}
+				auto new_proj = fatten(state.world, state.world.force_create_province_building_construction(c.province, n));
+				new_proj.set_is_pop_project(false);
+				new_proj.set_type(c.building_type);
+			} else {
+				auto new_up = fatten(state.world, state.world.force_create_state_building_construction(c.state, n));
+				new_up.set_is_pop_project(false);
+				new_up.set_is_upgrade(c.is_upgrade);
+				new_up.set_type(c.factory_type);
+			}
+		}
+	}
 }
 
 void update_ai_colonial_investment(sys::state& state) {
@@ -2019,75 +2081,96 @@ void civilize(sys::state& state) {
 	}
 }
 
-void take_reforms(sys::state& state) {
-	for(auto n : state.world.in_nation) {
-		if(n.get_is_player_controlled() || n.get_owned_province_count() == 0)
-			continue;
-
-		if(n.get_is_civilized()) { // political & social
-			// Enact social policies to deter Jacobin rebels from overruning the country
-			// Reactionaries will popup in effect but they are MORE weak that Jacobins
-			dcon::issue_option_id iss;
-			float max_support = 0.0f;
+struct ai_reform_intent {
+	dcon::issue_option_id issue;
+	dcon::reform_option_id reform;
+};
 
-			for(auto m : state.world.nation_get_movement_within(n)) {
-				if(m.get_movement().get_associated_issue_option() && m.get_movement().get_pop_support() > max_support) {
-					iss = m.get_movement().get_associated_issue_option();
-					max_support = m.get_movement().get_pop_support();
-				}
-			}
-			if(!iss || !command::can_enact_issue(state, n, iss)) {
-				max_support = 0.0f;
-				iss = dcon::issue_option_id{};
-				state.world.for_each_issue_option([&](dcon::issue_option_id io) {
-					if(command::can_enact_issue(state, n, io)) {
-						float support = 0.f;
-						for(const auto poid : state.world.nation_get_province_ownership_as_nation(n)) {
-							for(auto plid : state.world.province_get_pop_location_as_province(poid.get_province())) {
-								float weigth = plid.get_pop().get_size() * 0.001f;
-								support += pop_demographics::get_demo(state, plid.get_pop(), pop_demographics::to_key(state, io)) * weigth;
-							}
-						}
-						if(support > max_support) {
-							iss = io;
-							max_support = support;
+// picks the issue or reform that the nation will enact, if any; only reads the game state
+static ai_reform_intent decide_reform(sys::state& state, dcon::nation_id nid) {
+	auto n = fatten(state.world, nid);
+	if(n.get_is_player_controlled() || n.get_owned_province_count() == 0)
+		return ai_reform_intent{ };
+
+	if(n.get_is_civilized()) { // political & social
+		// Enact social policies to deter Jacobin rebels from overruning the country
+		// Reactionaries will popup in effect but they are MORE weak that Jacobins
+		dcon::issue_option_id iss;
+		float max_support = 0.0f;
+
+		for(auto m : state.world.nation_get_movement_within(n)) {
+			if(m.get_movement().get_associated_issue_option() && m.get_movement().get_pop_support() > max_support) {
+				iss = m.get_movement().get_associated_issue_option();
+				max_support = m.get_movement().get_pop_support();
+			}
+		}
+		if(!iss || !command::can_enact_issue(state, n, iss)) {
+			max_support = 0.0f;
+			iss = dcon::issue_option_id{};
+			state.world.for_each_issue_option([&](dcon::issue_option_id io) {
+				if(command::can_enact_issue(state, n, io)) {
+					float support = 0.f;
+					for(const auto poid : state.world.nation_get_province_ownership_as_nation(n)) {
+						for(auto plid : state.world.province_get_pop_location_as_province(poid.get_province())) {
+							float weigth = plid.get_pop().get_size() * 0.001f;
+							support += pop_demographics::get_demo(state, plid.get_pop(), pop_demographics::to_key(state, io)) * weigth;
 						}
 					}
-				});
-			}
-			if(iss) {
-				nations::enact_issue(state, n, iss);
-			}
-		} else { // military and economic
-			dcon::reform_option_id cheap_r;
-			float cheap_cost = 0.0f;
+					if(support > max_support) {
+						iss = io;
+						max_support = support;
+					}
+				}
+			});
+		}
+		return ai_reform_intent{ iss, dcon::reform_option_id{} };
+	} else { // military and economic
+		dcon::reform_option_id cheap_r;
+		float cheap_cost = 0.0f;
 
-			auto e_mul = politics::get_economic_reform_multiplier(state, n);
-			auto m_mul = politics::get_military_reform_multiplier(state, n);
+		auto e_mul = politics::get_economic_reform_multiplier(state, n);
+		auto m_mul = politics::get_military_reform_multiplier(state, n);
 
-			for(auto r : state.world.in_reform_option) {
-				bool is_military = state.world.reform_get_reform_type(state.world.reform_option_get_parent_reform(r)) == uint8_t(culture::issue_category::military);
+		for(auto r : state.world.in_reform_option) {
+			bool is_military = state.world.reform_get_reform_type(state.world.reform_option_get_parent_reform(r)) == uint8_t(culture::issue_category::military);
 
-				auto reform = state.world.reform_option_get_parent_reform(r);
-				auto current = state.world.nation_get_reforms(n, reform.id).id;
-				auto allow = state.world.reform_option_get_allow(r);
+			auto reform = state.world.reform_option_get_parent_reform(r);
+			auto current = state.world.nation_get_reforms(n, reform.id).id;
+			auto allow = state.world.reform_option_get_allow(r);
 
-				if(r.id.index() > current.index() && (!state.world.reform_get_is_next_step_only(reform.id) || current.index() + 1 == r.id.index()) && (!allow || trigger::evaluate(state, allow, trigger::to_generic(n.id), trigger::to_generic(n.id), 0))) {
+			if(r.id.index() > current.index() && (!state.world.reform_get_is_next_step_only(reform.id) || current.index() + 1 == r.id.index()) && (!allow || trigger::evaluate(state, allow, trigger::to_generic(n.id), trigger::to_generic(n.id), 0))) {
 
-					float base_cost = float(state.world.reform_option_get_technology_cost(r));
-					float reform_factor = is_military ? m_mul : e_mul;
+				float base_cost = float(state.world.reform_option_get_technology_cost(r));
+				float reform_factor = is_military ? m_mul : e_mul;
 
-					if(!cheap_r || base_cost * reform_factor < cheap_cost) {
-						cheap_cost = base_cost * reform_factor;
-						cheap_r = r.id;
-					}
+				if(!cheap_r || base_cost * reform_factor < cheap_cost) {
+					cheap_cost = base_cost * reform_factor;
+					cheap_r = r.id;
 				}
 			}
+		}
 
-			if(cheap_r && cheap_cost <= n.get_research_points()) {
-				nations::enact_reform(state, n, cheap_r);
-			}
+		if(cheap_r && cheap_cost <= n.get_research_points()) {
+			return ai_reform_intent{ dcon::issue_option_id{}, cheap_r };
 		}
+		return ai_reform_intent{ };
+	}
+}
+
+void take_reforms(sys::state& state) {
+	static std::vector<ai_reform_intent> intents;
+	intents.resize(state.world.nation_size());
+
+	concurrency::parallel_for(uint32_t(0), state.world.nation_size(), [&](uint32_t i) {
+		intents[i] = decide_reform(state, dcon::nation_id{ dcon::nation_id::value_base_t(i) });
+	});
+
+	for(uint32_t i = 0; i < state.world.nation_size(); ++i) {
+		dcon::nation_id n{ dcon::nation_id::value_base_t(i) };
+		if(intents[i].issue)
+			nations::enact_issue(state, n, intents[i].issue);
+		else if(intents[i].reform)
+			nations::enact_reform(state, n, intents[i].reform);
 	}
 }
 
@@ -4092,149 +4175,167 @@ void update_ships(sys::state& state) {
 	}
 }
 
-void build_ships(sys::state& state) {
-	for(auto n : state.world.in_nation) {
-		if(!n.get_is_player_controlled() && n.get_province_naval_construction().begin() == n.get_province_naval_construction().end()) {
-			auto disarm = n.get_disarmed_until();
-			if(disarm && state.current_date < disarm)
-				continue;
+struct ai_ship_intent {
+	dcon::province_id port;
+	dcon::unit_type_id type;
+};
 
-			dcon::unit_type_id best_transport;
-			dcon::unit_type_id best_light;
-			dcon::unit_type_id best_big;
+// picks the ships that the nation will start building; only reads the game state
+static void decide_ships(sys::state& state, dcon::nation_id nid, std::vector<ai_ship_intent>& intents) {
+	auto n = fatten(state.world, nid);
+	if(n.get_is_player_controlled() || n.get_province_naval_construction().begin() != n.get_province_naval_construction().end())
+		return;
+	auto disarm = n.get_disarmed_until();
+	if(disarm && state.current_date < disarm)
+		return;
 
-			for(uint32_t i = 2; i < state.military_definitions.unit_base_definitions.size(); ++i) {
-				dcon::unit_type_id j{ dcon::unit_type_id::value_base_t(i) };
-				if(!n.get_active_unit(j) && !state.military_definitions.unit_base_definitions[j].active)
-					continue;
+	dcon::unit_type_id best_transport;
+	dcon::unit_type_id best_light;
+	dcon::unit_type_id best_big;
 
-				if(state.military_definitions.unit_base_definitions[j].type == military::unit_type::transport) {
-					if(!best_transport || state.military_definitions.unit_base_definitions[best_transport].defence_or_hull < state.military_definitions.unit_base_definitions[j].defence_or_hull) {
-						best_transport = j;
-					}
-				} else if(state.military_definitions.unit_base_definitions[j].type == military::unit_type::light_ship) {
-					if(!best_light || state.military_definitions.unit_base_definitions[best_light].defence_or_hull < state.military_definitions.unit_base_definitions[j].defence_or_hull) {
-						best_light = j;
-					}
-				} else if(state.military_definitions.unit_base_definitions[j].type == military::unit_type::big_ship) {
-					if(!best_big || state.military_definitions.unit_base_definitions[best_big].defence_or_hull < state.military_definitions.unit_base_definitions[j].defence_or_hull) {
-						best_big = j;
-					}
-				}
+	for(uint32_t i = 2; i < state.military_definitions.unit_base_definitions.size(); ++i) {
+		dcon::unit_type_id j{ dcon::unit_type_id::value_base_t(i) };
+		if(!n.get_active_unit(j) && !state.military_definitions.unit_base_definitions[j].active)
+			continue;
+
+		if(state.military_definitions.unit_base_definitions[j].type == military::unit_type::transport) {
+			if(!best_transport || state.military_definitions.unit_base_definitions[best_transport].defence_or_hull < state.military_definitions.unit_base_definitions[j].defence_or_hull) {
+				best_transport = j;
 			}
+		} else if(state.military_definitions.unit_base_definitions[j].type == military::unit_type::light_ship) {
+			if(!best_light || state.military_definitions.unit_base_definitions[best_light].defence_or_hull < state.military_definitions.unit_base_definitions[j].defence_or_hull) {
+				best_light = j;
+			}
+		} else if(state.military_definitions.unit_base_definitions[j].type == military::unit_type::big_ship) {
+			if(!best_big || state.military_definitions.unit_base_definitions[best_big].defence_or_hull < state.military_definitions.unit_base_definitions[j].defence_or_hull) {
+				best_big = j;
+			}
+		}
+	}
 
-			int32_t num_transports = 0;
-			int32_t fleet_cap_in_transports = 0;
-			int32_t fleet_cap_in_small = 0;
-			int32_t fleet_cap_in_big = 0;
+	int32_t num_transports = 0;
+	int32_t fleet_cap_in_transports = 0;
+	int32_t fleet_cap_in_small = 0;
+	int32_t fleet_cap_in_big = 0;
 
-			for(auto v : n.get_navy_control()) {
-				for(auto s : v.get_navy().get_navy_membership()) {
-					auto type = s.get_ship().get_type();
-					if(state.military_definitions.unit_base_definitions[type].type == military::unit_type::transport) {
-						++num_transports;
-						fleet_cap_in_transports += state.military_definitions.unit_base_definitions[type].supply_consumption_score;
-					} else if(state.military_definitions.unit_base_definitions[type].type == military::unit_type::big_ship) {
-						fleet_cap_in_big += state.military_definitions.unit_base_definitions[type].supply_consumption_score;
-					} else if(state.military_definitions.unit_base_definitions[type].type == military::unit_type::light_ship) {
-						fleet_cap_in_small += state.military_definitions.unit_base_definitions[type].supply_consumption_score;
-					}
-				}
+	for(auto v : n.get_navy_control()) {
+		for(auto s : v.get_navy().get_navy_membership()) {
+			auto type = s.get_ship().get_type();
+			if(state.military_definitions.unit_base_definitions[type].type == military::unit_type::transport) {
+				++num_transports;
+				fleet_cap_in_transports += state.military_definitions.unit_base_definitions[type].supply_consumption_score;
+			} else if(state.military_definitions.unit_base_definitions[type].type == military::unit_type::big_ship) {
+				fleet_cap_in_big += state.military_definitions.unit_base_definitions[type].supply_consumption_score;
+			} else if(state.military_definitions.unit_base_definitions[type].type == military::unit_type::light_ship) {
+				fleet_cap_in_small += state.military_definitions.unit_base_definitions[type].supply_consumption_score;
 			}
+		}
+	}
+
+	std::vector<dcon::province_id> owned_ports;
+	for(auto p : n.get_province_ownership()) {
+		if(p.get_province().get_is_coast() && p.get_province().get_nation_from_province_control() == n) {
+			owned_ports.push_back(p.get_province().id);
+		}
+	}
+	auto cap = n.get_capital().id;
+	std::sort(owned_ports.begin(), owned_ports.end(), [&](dcon::province_id a, dcon::province_id b) {
+		auto a_dist = province::sorting_distance(state, a, cap);
+		auto b_dist = province::sorting_distance(state, b, cap);
+		if(a_dist != b_dist)
+			return a_dist < b_dist;
+		else
+			return a.index() < b.index();
+	});
 
-			static std::vector<dcon::province_id> owned_ports;
-			owned_ports.clear();
-			for(auto p : n.get_province_ownership()) {
-				if(p.get_province().get_is_coast() && p.get_province().get_nation_from_province_control() == n) {
-					owned_ports.push_back(p.get_province().id);
+	int32_t constructing_fleet_cap = 0;
+	if(best_transport) {
+		if(fleet_cap_in_transports * 3 < n.get_naval_supply_points()) {
+			auto overseas_allowed = state.military_definitions.unit_base_definitions[best_transport].can_build_overseas;
+			auto level_req = state.military_definitions.unit_base_definitions[best_transport].min_port_level;
+			auto supply_pts = state.military_definitions.unit_base_definitions[best_transport].supply_consumption_score;
+
+			for(uint32_t j = 0; j < owned_ports.size() && (fleet_cap_in_transports + constructing_fleet_cap) * 3 < n.get_naval_supply_points(); ++j) {
+				if((overseas_allowed || !province::is_overseas(state, owned_ports[j]))
+					&& state.world.province_get_building_level(owned_ports[j], uint8_t(economy::province_building_type::naval_base)) >= level_req) {
+					assert(command::can_start_naval_unit_construction(state, n, owned_ports[j], best_transport));
+					intents.push_back(ai_ship_intent{ owned_ports[j], best_transport });
+					constructing_fleet_cap += supply_pts;
 				}
 			}
-			auto cap = n.get_capital().id;
-			std::sort(owned_ports.begin(), owned_ports.end(), [&](dcon::province_id a, dcon::province_id b) {
-				auto a_dist = province::sorting_distance(state, a, cap);
-				auto b_dist = province::sorting_distance(state, b, cap);
-				if(a_dist != b_dist)
-					return a_dist < b_dist;
-				else
-					return a.index() < b.index();
-			});
-
-			int32_t constructing_fleet_cap = 0;
-			if(best_transport) {
-				if(fleet_cap_in_transports * 3 < n.get_naval_supply_points()) {
-					auto overseas_allowed = state.military_definitions.unit_base_definitions[best_transport].can_build_overseas;
-					auto level_req = state.military_definitions.unit_base_definitions[best_transport].min_port_level;
-					auto supply_pts = state.military_definitions.unit_base_definitions[best_transport].supply_consumption_score;
-
-					for(uint32_t j = 0; j < owned_ports.size() && (fleet_cap_in_transports + constructing_fleet_cap) * 3 < n.get_naval_supply_points(); ++j) {
-						if((overseas_allowed || !province::is_overseas(state, owned_ports[j]))
-							&& state.world.province_get_building_level(owned_ports[j], uint8_t(economy::province_building_type::naval_base)) >= level_req) {
-							assert(command::can_start_naval_unit_construction(state, n, owned_ports[j], best_transport));
-							auto c = fatten(state.world, state.world.try_create_province_naval_construction(owned_ports[j], n));
-							c.set_type(best_transport);
-							constructing_fleet_cap += supply_pts;
-						}
-					}
-				} else if(num_transports < 10) {
-					auto overseas_allowed = state.military_definitions.unit_base_definitions[best_transport].can_build_overseas;
-					auto level_req = state.military_definitions.unit_base_definitions[best_transport].min_port_level;
-					auto supply_pts = state.military_definitions.unit_base_definitions[best_transport].supply_consumption_score;
-
-					for(uint32_t j = 0; j < owned_ports.size() && num_transports < 10; ++j) {
-						if((overseas_allowed || !province::is_overseas(state, owned_ports[j]))
-							&& state.world.province_get_building_level(owned_ports[j], uint8_t(economy::province_building_type::naval_base)) >= level_req) {
-							assert(command::can_start_naval_unit_construction(state, n, owned_ports[j], best_transport));
-							auto c = fatten(state.world, state.world.try_create_province_naval_construction(owned_ports[j], n));
-							c.set_type(best_transport);
-							++num_transports;
-							constructing_fleet_cap += supply_pts;
-						}
-					}
+		} else if(num_transports < 10) {
+			auto overseas_allowed = state.military_definitions.unit_base_definitions[best_transport].can_build_overseas;
+			auto level_req = state.military_definitions.unit_base_definitions[best_transport].min_port_level;
+			auto supply_pts = state.military_definitions.unit_base_definitions[best_transport].supply_consumption_score;
+
+			for(uint32_t j = 0; j < owned_ports.size() && num_transports < 10; ++j) {
+				if((overseas_allowed || !province::is_overseas(state, owned_ports[j]))
+					&& state.world.province_get_building_level(owned_ports[j], uint8_t(economy::province_building_type::naval_base)) >= level_req) {
+					assert(command::can_start_naval_unit_construction(state, n, owned_ports[j], best_transport));
+					intents.push_back(ai_ship_intent{ owned_ports[j], best_transport });
+					++num_transports;
+					constructing_fleet_cap += supply_pts;
 				}
 			}
+		}
+	}
 
-			int32_t used_points = n.get_used_naval_supply_points();
-			auto rem_free = n.get_naval_supply_points() - (fleet_cap_in_transports + fleet_cap_in_small + fleet_cap_in_big + constructing_fleet_cap);
-			fleet_cap_in_small = std::max(fleet_cap_in_small, 1);
-			fleet_cap_in_big = std::max(fleet_cap_in_big, 1);
+	int32_t used_points = n.get_used_naval_supply_points();
+	auto rem_free = n.get_naval_supply_points() - (fleet_cap_in_transports + fleet_cap_in_small + fleet_cap_in_big + constructing_fleet_cap);
+	fleet_cap_in_small = std::max(fleet_cap_in_small, 1);
+	fleet_cap_in_big = std::max(fleet_cap_in_big, 1);
 
-			auto free_big_points = best_light ? rem_free * fleet_cap_in_small / (fleet_cap_in_small + fleet_cap_in_big) : rem_free;
-			auto free_small_points = best_big ? rem_free * fleet_cap_in_big / (fleet_cap_in_small + fleet_cap_in_big) : rem_free;
+	auto free_big_points = best_light ? rem_free * fleet_cap_in_small / (fleet_cap_in_small + fleet_cap_in_big) : rem_free;
+	auto free_small_points = best_big ? rem_free * fleet_cap_in_big / (fleet_cap_in_small + fleet_cap_in_big) : rem_free;
 
-			if(best_light) {
-				auto overseas_allowed = state.military_definitions.unit_base_definitions[best_light].can_build_overseas;
-				auto level_req = state.military_definitions.unit_base_definitions[best_light].min_port_level;
-				auto supply_pts = state.military_definitions.unit_base_definitions[best_light].supply_consumption_score;
+	if(best_light) {
+		auto overseas_allowed = state.military_definitions.unit_base_definitions[best_light].can_build_overseas;
+		auto level_req = state.military_definitions.unit_base_definitions[best_light].min_port_level;
+		auto supply_pts = state.military_definitions.unit_base_definitions[best_light].supply_consumption_score;
 
-				for(uint32_t j = 0; j < owned_ports.size() && supply_pts <= free_small_points; ++j) {
-					if((overseas_allowed || !province::is_overseas(state, owned_ports[j]))
-						&& state.world.province_get_building_level(owned_ports[j], uint8_t(economy::province_building_type::naval_base)) >= level_req) {
-						assert(command::can_start_naval_unit_construction(state, n, owned_ports[j], best_light));
-						auto c = fatten(state.world, state.world.try_create_province_naval_construction(owned_ports[j], n));
-						c.set_type(best_light);
-						free_small_points -= supply_pts;
-					}
-				}
+		for(uint32_t j = 0; j < owned_ports.size() && supply_pts <= free_small_points; ++j) {
+			if((overseas_allowed || !province::is_overseas(state, owned_ports[j]))
+				&& state.world.province_get_building_level(owned_ports[j], uint8_t(economy::province_building_type::naval_base)) >= level_req) {
+				assert(command::can_start_naval_unit_construction(state, n, owned_ports[j], best_light));
+				intents.push_back(ai_ship_intent{ owned_ports[j], best_light });
+				free_small_points -= supply_pts;
 			}
-			if(best_big) {
-				auto overseas_allowed = state.military_definitions.unit_base_definitions[best_big].can_build_overseas;
-				auto level_req = state.military_definitions.unit_base_definitions[best_big].min_port_level;
-				auto supply_pts = state.military_definitions.unit_base_definitions[best_big].supply_consumption_score;
-
-				for(uint32_t j = 0; j < owned_ports.size() && supply_pts <= free_big_points; ++j) {
-					if((overseas_allowed || !province::is_overseas(state, owned_ports[j]))
-						&& state.world.province_get_building_level(owned_ports[j], uint8_t(economy::province_building_type::naval_base)) >= level_req) {
-						assert(command::can_start_naval_unit_construction(state, n, owned_ports[j], best_big));
-						auto c = fatten(state.world, state.world.try_create_province_naval_construction(owned_ports[j], n));
-						c.set_type(best_big);
-						free_big_points -= supply_pts;
-					}
-				}
+		}
+	}
+	if(best_big) {
+		auto overseas_allowed = state.military_definitions.unit_base_definitions[best_big].can_build_overseas;
+		auto level_req = state.military_definitions.unit_base_definitions[best_big].min_port_level;
+		auto supply_pts = state.military_definitions.unit_base_definitions[best_big].supply_consumption_score;
+
+		for(uint32_t j = 0; j < owned_ports.size() && supply_pts <= free_big_points; ++j) {
+			if((overseas_allowed || !province::is_overseas(state, owned_ports[j]))
+				&& state.world.province_get_building_level(owned_ports[j], uint8_t(economy::province_building_type::naval_base)) >= level_req) {
+				assert(command::can_start_naval_unit_construction(state, n, owned_ports[j], best_big));
+				intents.push_back(ai_ship_intent{ owned_ports[j], best_big });
+				free_big_points -= supply_pts;
 			}
 		}
 	}
 }
 
+void build_ships(sys::state& state) {
+	static std::vector<std::vector<ai_ship_intent>> intents;
+	intents.resize(state.world.nation_size());
+
+	concurrency::parallel_for(uint32_t(0), state.world.nation_size(), [&](uint32_t i) {
+		intents[i].clear();
+		decide_ships(state, dcon::nation_id{ dcon::nation_id::value_base_t(i) }, intents[i]);
+	});
+
+	for(uint32_t i = 0; i < state.world.nation_size(); ++i) {
+		dcon::nation_id n{ dcon::nation_id::value_base_t(i) };
+		for(auto& s : intents[i]) {
+			auto c = fatten(state.world, state.world.try_create_province_naval_construction(s.port, n));
+			c.set_type(s.type);
+		}
+	}
+}
+
 dcon::province_id get_home_port(sys::state& state, dcon::nation_id n) {
 	auto cap = state.world.nation_get_capital(n);
 	int32_t max_level = -1;
@@ -4840,6 +4941,7 @@ dcon::navy_id find_transport_fleet(sys::state& state, dcon::nation_id controller
 void move_idle_guards(sys::state& state) {
 	std::vector<dcon::army_id> require_transport;
 	require_transport.reserve(state.world.army_size());
+	std::vector<dcon::province_id> path;
 
 	for(auto ar : state.world.in_army) {
 		if(ar.get_ai_activity() == uint8_t(army_activity::on_guard)
@@ -4851,7 +4953,10 @@ void move_idle_guards(sys::state& state) {
 			&& !ar.get_battle_from_army_battle_participation()
 			&& !ar.get_navy_from_army_transport()) {
 
-			auto path = ar.get_black_flag() ? province::make_unowned_land_path(state, ar.get_location_from_army_location(), ar.get_ai_province()) : province::make_land_path(state, ar.get_location_from_army_location(), ar.get_ai_province(), ar.get_controller_from_army_control(), ar);
+			if(ar.get_black_flag())
+				province::make_unowned_land_path(state, ar.get_location_from_army_location(), ar.get_ai_province(), path);
+			else
+				province::make_land_path(state, ar.get_location_from_army_location(), ar.get_ai_province(), ar.get_controller_from_army_control(), ar, path);
 			if(path.size() > 0) {
 				auto existing_path = ar.get_path();
 				auto new_size = uint32_t(path.size());
@@ -4895,9 +5000,10 @@ void move_idle_guards(sys::state& state) {
 		}
 
 		if(!state.world.province_get_is_coast(coastal_target_prov)) {
-			auto path = state.world.army_get_black_flag(require_transport[i])
-				? province::make_unowned_path_to_nearest_coast(state, coastal_target_prov)
-				: province::make_path_to_nearest_coast(state, controller, coastal_target_prov);
+			if(state.world.army_get_black_flag(require_transport[i]))
+				province::make_unowned_path_to_nearest_coast(state, coastal_target_prov, path);
+			else
+				province::make_path_to_nearest_coast(state, controller, coastal_target_prov, path);
 			if(path.empty()) {
 				state.world.army_set_ai_province(require_transport[i], dcon::province_id{}); // stop rechecking unit
 				continue; // army could not reach coast
@@ -5047,6 +5153,7 @@ bool army_ready_for_battle(sys::state& state, dcon::nation_id n, dcon::army_id a
 }
 
 void gather_to_battle(sys::state& state, dcon::nation_id n, dcon::province_id p) {
+	std::vector<dcon::province_id> jpath;
 	for(auto ar : state.world.nation_get_army_control(n)) {
 		army_activity activity = army_activity(ar.get_army().get_ai_activity());
 		if(ar.get_army().get_battle_from_army_battle_participation()
@@ -5067,7 +5174,7 @@ void gather_to_battle(sys::state& state, dcon::nation_id n, dcon::province_id p)
 		if(sdist > state.defines.alice_ai_gather_radius)
 			continue;
 
-		auto jpath = province::make_land_path(state, location, p, n, ar.get_army());
+		province::make_land_path(state, location, p, n, ar.get_army(), jpath);
 		if(!jpath.empty()) {
 
 			auto existing_path = ar.get_army().get_path();
@@ -5250,6 +5357,7 @@ void assign_targets(sys::state& state, dcon::nation_id n) {
 		float minimal_distance;
 		dcon::province_id location;
 		float strength_estimate = 0.0f;
+		float path_distance = std::numeric_limits<float>::infinity();
 	};
 
 	/* Ourselves */
@@ -5313,7 +5421,49 @@ void assign_targets(sys::state& state, dcon::nation_id n) {
 			}
 		}
 	}
+
+	bool is_at_war = state.world.nation_get_is_at_war(n);
+	int32_t min_ready_count = std::min(ready_count, 3); //Atleast 3 attacks
+	int32_t max_attacks_to_make = is_at_war ? std::max(min_ready_count, (ready_count + 1) / 3) : ready_count; // not at war -- allow all stacks to attack rebels
+
+	// targets are ranked by the length of the land path from the nearest army location, with one search per distinct location. A
+	// search stops after finding a few more targets than attacks will be made, as some are skipped, and does not go further than
+	// twice the direct distance to the target that is that many places down by sorting distance (or to the last one, when there
+	// are fewer), so that it does not flood the whole landmass when most targets cannot be reached by land. Targets that no search
+	// reached are ranked after the others by their sorting distance
+	static thread_local province::distance_field army_distances;
+	static thread_local std::vector<dcon::province_id> target_locations;
+	static thread_local std::vector<dcon::province_id> army_locations;
+	static thread_local std::vector<float> sorting_distances;
+	auto const targets_to_find = 2 * max_attacks_to_make;
+	target_locations.clear();
+	sorting_distances.clear();
+	for(auto& pt : potential_targets) {
+		target_locations.push_back(pt.location);
+		sorting_distances.push_back(pt.minimal_distance);
+	}
+	float distance_limit = std::numeric_limits<float>::infinity();
+	if(targets_to_find > 0 && !sorting_distances.empty()) {
+		auto kth = sorting_distances.begin() + (std::min(size_t(targets_to_find), sorting_distances.size()) - 1);
+		std::nth_element(sorting_distances.begin(), kth, sorting_distances.end());
+		distance_limit = 2.0f * math::acos(std::clamp(-*kth, -1.0f, 1.0f)) * (province::world_circumference / (2.0f * math::pi));
+	}
+	army_locations.clear();
+	for(auto& ra : ready_armies) {
+		army_locations.push_back(ra.p);
+	}
+	std::sort(army_locations.begin(), army_locations.end(), [](dcon::province_id a, dcon::province_id b) { return a.index() < b.index(); });
+	army_locations.erase(std::unique(army_locations.begin(), army_locations.end()), army_locations.end());
+	for(auto p : army_locations) {
+		province::find_land_distances(state, p, n, dcon::army_id{}, target_locations, targets_to_find, distance_limit, army_distances);
+		for(auto& pt : potential_targets) {
+			pt.path_distance = std::min(pt.path_distance, army_distances.distance_to(pt.location));
+		}
+	}
+
 	std::sort(potential_targets.begin(), potential_targets.end(), [&](army_target& a, army_target& b) {
+		if(a.path_distance != b.path_distance)
+			return a.path_distance < b.path_distance;
 		if(a.minimal_distance != b.minimal_distance)
 			return a.minimal_distance < b.minimal_distance;
 		else
@@ -5321,9 +5471,6 @@ void assign_targets(sys::state& state, dcon::nation_id n) {
 	});
 
 	// organize attack stacks
-	bool is_at_war = state.world.nation_get_is_at_war(n);
-	int32_t min_ready_count = std::min(ready_count, 3); //Atleast 3 attacks
-	int32_t max_attacks_to_make = is_at_war ? std::max(min_ready_count, (ready_count + 1) / 3) : ready_count; // not at war -- allow all stacks to attack rebels
 	auto const psize = potential_targets.size();
 
 	for(uint32_t i = 0; i < psize && max_attacks_to_make > 0; ++i) {
@@ -9,8 +9,6 @@
 #include "ve_scalar_extensions.hpp"
 #include "container_types.hpp"
 
-// #define CHECK_LLVM_RESULTS
-
 namespace pop_demographics {
 
 dcon::pop_demographics_key to_key(sys::state const& state, dcon::ideology_id v) {
@@ -185,6 +183,8 @@ uint32_t common_size(sys::state const& state) {
 	return count_special_keys + uint32_t(2) * state.world.pop_type_size();
 }
 
+void sum_province_demographics_upwards(sys::state& state, dcon::demographics_key key);
+
 template<typename F>
 void sum_over_demographics(sys::state& state, dcon::demographics_key key, F const& source) {
 	// clear province
@@ -194,6 +194,10 @@ void sum_over_demographics(sys::state& state, dcon::demographics_key key, F cons
 		auto location = state.world.pop_get_province_from_pop_location(p);
 		state.world.province_get_demographics(location, key) += source(state, p);
 	});
+	sum_province_demographics_upwards(state, key);
+}
+
+void sum_province_demographics_upwards(sys::state& state, dcon::demographics_key key) {
 	// clear state
 	state.world.execute_serial_over_state_instance(
 			[&](auto si) { state.world.state_instance_set_demographics(si, key, ve::fp_vector()); });
@@ -285,12 +289,119 @@ void regenerate_jingoism_support(sys::state& state, dcon::nation_id n) {
 	}
 }
 
+//
+// Incremental aggregation: the keys that only depend on the size, type, culture, religion and location of a pop are not summed
+// from every pop each day. Instead, each pop remembers what it last contributed, and only pops whose contribution changed post
+// the difference into their province. Pops are visited in id order, so every client performs the same float operations.
+// States and nations are then summed from their provinces, which also picks up any change of ownership. A full rebuild
+// every incremental_rebuild_interval days bounds the float drift.
+//
+
+inline constexpr int32_t incremental_rebuild_interval = 32;
+
+bool incremental_aggregation_active(sys::state const& state) {
+	return state.defines.alice_incremental_demographics > 0.0f && state.network_mode != sys::network_mode_type::single_player;
+}
+
+bool is_incremental_key(sys::state const& state, uint32_t index) {
+	if(index < count_special_keys) {
+		return index == total.index() || index == employable.index() || index == poor_total.index()
+			|| index == middle_total.index() || index == rich_total.index();
+	}
+	if(index < uint32_t(to_employment_key(state, dcon::pop_type_id(0)).index())) // pop type
+		return true;
+	if(index < uint32_t(to_key(state, dcon::culture_id(0)).index())) { // employment, which is just the size for types without unemployment
+		dcon::pop_type_id pkey{ dcon::pop_type_id::value_base_t(index - (count_special_keys + state.world.pop_type_size())) };
+		return !state.world.pop_type_get_has_unemployment(pkey);
+	}
+	if(index < uint32_t(to_key(state, dcon::ideology_id(0)).index())) // culture
+		return true;
+	if(index < uint32_t(to_key(state, dcon::religion_id(0)).index())) // ideology, issue option
+		return false;
+	return true; // religion
+}
+
+void add_pop_contribution(sys::state& state, dcon::province_id location, dcon::pop_type_id t, dcon::culture_id c, dcon::religion_id r, float amount) {
+	if(!location || amount == 0.0f)
+		return;
+	state.world.province_get_demographics(location, total) += amount;
+	if(t) {
+		if(state.world.pop_type_get_has_unemployment(t))
+			state.world.province_get_demographics(location, employable) += amount;
+		else
+			state.world.province_get_demographics(location, to_employment_key(state, t)) += amount;
+		switch(culture::pop_strata(state.world.pop_type_get_strata(t))) {
+		case culture::pop_strata::poor:
+			state.world.province_get_demographics(location, poor_total) += amount;
+			break;
+		case culture::pop_strata::middle:
+			state.world.province_get_demographics(location, middle_total) += amount;
+			break;
+		case culture::pop_strata::rich:
+			state.world.province_get_demographics(location, rich_total) += amount;
+			break;
+		default:
+			break;
+		}
+		state.world.province_get_demographics(location, to_key(state, t)) += amount;
+	}
+	if(c)
+		state.world.province_get_demographics(location, to_key(state, c)) += amount;
+	if(r)
+		state.world.province_get_demographics(location, to_key(state, r)) += amount;
+}
+
+void snapshot_pop_contributions(sys::state& state) {
+	state.world.execute_parallel_over_pop([&](auto ids) {
+		state.world.pop_set_demo_tracked_size(ids, state.world.pop_get_size(ids));
+		state.world.pop_set_demo_tracked_location(ids, state.world.pop_get_province_from_pop_location(ids));
+		state.world.pop_set_demo_tracked_poptype(ids, state.world.pop_get_poptype(ids));
+		state.world.pop_set_demo_tracked_culture(ids, state.world.pop_get_culture(ids));
+		state.world.pop_set_demo_tracked_religion(ids, state.world.pop_get_religion(ids));
+	});
+}
+
+void apply_pop_contribution_deltas(sys::state& state) {
+	state.world.for_each_pop([&](dcon::pop_id p) {
+		auto size = state.world.pop_get_size(p);
+		auto location = state.world.pop_get_province_from_pop_location(p);
+		auto t = state.world.pop_get_poptype(p);
+		auto c = state.world.pop_get_culture(p);
+		auto r = state.world.pop_get_religion(p);
+
+		auto old_location = state.world.pop_get_demo_tracked_location(p);
+		auto old_t = state.world.pop_get_demo_tracked_poptype(p);
+		auto old_c = state.world.pop_get_demo_tracked_culture(p);
+		auto old_r = state.world.pop_get_demo_tracked_religion(p);
+		if(location == old_location && t == old_t && c == old_c && r == old_r) {
+			add_pop_contribution(state, location, t, c, r, size - state.world.pop_get_demo_tracked_size(p));
+		} else {
+			add_pop_contribution(state, old_location, old_t, old_c, old_r, -state.world.pop_get_demo_tracked_size(p));
+			add_pop_contribution(state, location, t, c, r, size);
+			state.world.pop_set_demo_tracked_location(p, location);
+			state.world.pop_set_demo_tracked_poptype(p, t);
+			state.world.pop_set_demo_tracked_culture(p, c);
+			state.world.pop_set_demo_tracked_religion(p, r);
+		}
+		state.world.pop_set_demo_tracked_size(p, size);
+	});
+}
+
+void remove_pop_contribution(sys::state& state, dcon::pop_id p) {
+	if(!incremental_aggregation_active(state))
+		return;
+	add_pop_contribution(state, state.world.pop_get_demo_tracked_location(p), state.world.pop_get_demo_tracked_poptype(p),
+		state.world.pop_get_demo_tracked_culture(p), state.world.pop_get_demo_tracked_religion(p), -state.world.pop_get_demo_tracked_size(p));
+	state.world.pop_set_demo_tracked_size(p, 0.0f);
+}
+
 template<bool full>
 void regenerate_from_pop_data(sys::state& state) {
 	auto const sz = size(state);
 	auto const csz = common_size(state);
 	auto const extra_size = sz - csz;
 	auto const extra_group_size = (extra_size + extra_demo_grouping - 1) / extra_demo_grouping;
+	bool const incremental = !full && incremental_aggregation_active(state);
 
 	concurrency::parallel_for(uint32_t(0), full ?  sz : csz + extra_group_size, [&](uint32_t base_index) {
 		auto index = base_index;
@@ -301,6 +412,8 @@ void regenerate_from_pop_data(sys::state& state) {
 					return;
 			}
 		}
+		if(incremental && is_incremental_key(state, index))
+			return;
 		dcon::demographics_key key{dcon::demographics_key::value_base_t(index)};
 		if(index < count_special_keys) {
 			switch(index) {
@@ -511,6 +624,18 @@ void regenerate_from_pop_data(sys::state& state) {
 		}
 	});
 
+	if constexpr(full) {
+		snapshot_pop_contributions(state);
+	} else {
+		if(incremental) {
+			apply_pop_contribution_deltas(state);
+			concurrency::parallel_for(uint32_t(0), sz, [&](uint32_t index) {
+				if(is_incremental_key(state, index))
+					sum_province_demographics_upwards(state, dcon::demographics_key{ dcon::demographics_key::value_base_t(index) });
+			});
+		}
+	}
+
 	//
 	// calculate values derived from demographics
 	//
@@ -861,7 +986,10 @@ void regenerate_from_pop_data_full(sys::state& state) {
 	regenerate_from_pop_data<true>(state);
 }
 void regenerate_from_pop_data_daily(sys::state& state) {
-	regenerate_from_pop_data<false>(state);
+	if(incremental_aggregation_active(state) && state.current_date.value % incremental_rebuild_interval == 0)
+		regenerate_from_pop_data<true>(state);
+	else
+		regenerate_from_pop_data<false>(state);
 }
 
 template<bool full>
@@ -2328,13 +2456,13 @@ void update_ideologies(sys::state& state, uint32_t offset, uint32_t divisions, i
 									using ftype = float(*)(int32_t);
 									ftype fn = (ftype)mfn;
 									float llvm_result = fn(pid.index());
-#ifdef CHECK_LLVM_RESULTS
-									float interp_result = 0.0f;
-									if(auto mtrigger = state.world.pop_type_get_ideology(ptid, i); mtrigger) {
-										interp_result = trigger::evaluate_multiplicative_modifier(state, mtrigger, trigger::to_generic(pid), trigger::to_generic(pid), 0);
+									if(state.jit_compare_mode.load(std::memory_order_relaxed)) {
+										float interp_result = 0.0f;
+										if(auto mtrigger = state.world.pop_type_get_ideology(ptid, i); mtrigger) {
+											interp_result = trigger::evaluate_multiplicative_modifier(state, mtrigger, trigger::to_generic(pid), trigger::to_generic(pid), 0);
+										}
+										state.record_jit_comparison(llvm_result, interp_result);
 									}
-									assert(llvm_result == interp_result);
-#endif
 									return llvm_result;
 								} else {
 									auto ptrigger = state.world.pop_type_get_ideology(ptid, i);
@@ -2354,13 +2482,13 @@ void update_ideologies(sys::state& state, uint32_t offset, uint32_t divisions, i
 								using ftype = float(*)(int32_t);
 								ftype fn = (ftype)mfn;
 								float llvm_result = fn(pid.index());
-#ifdef CHECK_LLVM_RESULTS
-								float interp_result = 0.0f;
-								if(auto mtrigger = state.world.pop_type_get_ideology(ptid, i); mtrigger) {
-									interp_result = trigger::evaluate_multiplicative_modifier(state, mtrigger, trigger::to_generic(pid), trigger::to_generic(pid), 0);
+								if(state.jit_compare_mode.load(std::memory_order_relaxed)) {
+									float interp_result = 0.0f;
+									if(auto mtrigger = state.world.pop_type_get_ideology(ptid, i); mtrigger) {
+										interp_result = trigger::evaluate_multiplicative_modifier(state, mtrigger, trigger::to_generic(pid), trigger::to_generic(pid), 0);
+									}
+									state.record_jit_comparison(llvm_result, interp_result);
 								}
-								assert(llvm_result == interp_result);
-#endif
 								return llvm_result;
 							} else {
 								auto ptrigger = state.world.pop_type_get_ideology(ptid, i);
@@ -2483,13 +2611,13 @@ void update_issues(sys::state& state, uint32_t offset, uint32_t divisions, issue
 						using ftype = float(*)(int32_t);
 						ftype fn = (ftype)mfn;
 						float llvm_result = fn(pid.index());
-#ifdef CHECK_LLVM_RESULTS
-						float interp_result = 0.0f;
-						if(auto mtrigger = state.world.pop_type_get_issues(ptid, iid); mtrigger) {
-							interp_result = trigger::evaluate_multiplicative_modifier(state, mtrigger, trigger::to_generic(pid), trigger::to_generic(pid), 0);
+						if(state.jit_compare_mode.load(std::memory_order_relaxed)) {
+							float interp_result = 0.0f;
+							if(auto mtrigger = state.world.pop_type_get_issues(ptid, iid); mtrigger) {
+								interp_result = trigger::evaluate_multiplicative_modifier(state, mtrigger, trigger::to_generic(pid), trigger::to_generic(pid), 0);
+							}
+							state.record_jit_comparison(llvm_result, interp_result);
 						}
-						assert(llvm_result == interp_result);
-#endif
 						return llvm_result;
 					} else { 
 						if(auto mtrigger = state.world.pop_type_get_issues(ptid, iid); mtrigger) {
@@ -2667,17 +2795,13 @@ void update_type_changes(sys::state& state, uint32_t offset, uint32_t divisions,
 	pexecute_staggered_blocks(offset, divisions, state.world.pop_size(), [&](auto ids) {
 		pbuf.amounts.set(ids, 0.0f);
 		auto owners = nations::owner_of_pop(state, ids);
-#ifdef CHECK_LLVM_RESULTS
-		auto promotion_chances = trigger::evaluate_additive_modifier(state, state.culture_definitions.promotion_chance, trigger::to_generic(ids), trigger::to_generic(ids), 0);
-		auto demotion_chances = trigger::evaluate_additive_modifier(state, state.culture_definitions.demotion_chance, trigger::to_generic(ids), trigger::to_generic(ids), 0);
-#else
+		bool const compare_jit = state.jit_compare_mode.load(std::memory_order_relaxed);
 		ve::fp_vector promotion_chances;
-		if(state.culture_definitions.promotion_chance_fn == 0)
+		if(state.culture_definitions.promotion_chance_fn == 0 || compare_jit)
 			promotion_chances = trigger::evaluate_additive_modifier(state, state.culture_definitions.promotion_chance, trigger::to_generic(ids), trigger::to_generic(ids), 0);
 		ve::fp_vector demotion_chances;
-		if(state.culture_definitions.demotion_chance_fn == 0)
+		if(state.culture_definitions.demotion_chance_fn == 0 || compare_jit)
 			demotion_chances = trigger::evaluate_additive_modifier(state, state.culture_definitions.demotion_chance, trigger::to_generic(ids), trigger::to_generic(ids), 0);
-#endif
 		ve::apply(
 				[&](dcon::pop_id p, dcon::nation_id owner, float promotion_chance, float demotion_chance) {
 					/*
@@ -2713,17 +2837,15 @@ void update_type_changes(sys::state& state, uint32_t offset, uint32_t divisions,
 					if(state.culture_definitions.promotion_chance_fn) {
 						ftypeb fn = (ftypeb)(state.culture_definitions.promotion_chance_fn);
 						float llvm_result = fn(p.index());
-#ifdef CHECK_LLVM_RESULTS
-						assert(llvm_result == promotion_chance);
-#endif
+						if(compare_jit)
+							state.record_jit_comparison(llvm_result, promotion_chance);
 						promotion_chance = llvm_result;
 					}
 					if(state.culture_definitions.demotion_chance_fn) {
 						ftypeb fn = (ftypeb)(state.culture_definitions.demotion_chance_fn);
 						float llvm_result = fn(p.index());
-#ifdef CHECK_LLVM_RESULTS
-						assert(llvm_result == demotion_chance);
-#endif
+						if(compare_jit)
+							state.record_jit_comparison(llvm_result, demotion_chance);
 						demotion_chance = llvm_result;
 					}
 
@@ -2785,13 +2907,13 @@ void update_type_changes(sys::state& state, uint32_t offset, uint32_t divisions,
 							using ftype = float(*)(int32_t);
 							ftype fn = (ftype)mfn;
 							float llvm_result = fn(p.index());
-#ifdef CHECK_LLVM_RESULTS
-							float interp_result = 0.0f;
-							if(auto mtrigger = state.world.pop_type_get_promotion(ptype, promoted_type); mtrigger) {
-								interp_result = trigger::evaluate_additive_modifier(state, mtrigger, trigger::to_generic(p), trigger::to_generic(p), 0);
+							if(state.jit_compare_mode.load(std::memory_order_relaxed)) {
+								float interp_result = 0.0f;
+								if(auto mtrigger = state.world.pop_type_get_promotion(ptype, promoted_type); mtrigger) {
+									interp_result = trigger::evaluate_additive_modifier(state, mtrigger, trigger::to_generic(p), trigger::to_generic(p), 0);
+								}
+								state.record_jit_comparison(llvm_result, interp_result);
 							}
-							assert(llvm_result == interp_result);
-#endif
 							chance = llvm_result + promotion_bonus;
 						} else {
 							if(auto mtrigger = state.world.pop_type_get_promotion(ptype, promoted_type); mtrigger) {
@@ -2820,13 +2942,13 @@ void update_type_changes(sys::state& state, uint32_t offset, uint32_t divisions,
 								using ftype = float(*)(int32_t);
 								ftype fn = (ftype)mfn;
 								float llvm_result = fn(p.index());
-#ifdef CHECK_LLVM_RESULTS
-								float interp_result = 0.0f;
-								if(auto mtrigger = state.world.pop_type_get_promotion(ptype, target_type); mtrigger) {
-									interp_result = trigger::evaluate_additive_modifier(state, mtrigger, trigger::to_generic(p), trigger::to_generic(p), 0);
+								if(state.jit_compare_mode.load(std::memory_order_relaxed)) {
+									float interp_result = 0.0f;
+									if(auto mtrigger = state.world.pop_type_get_promotion(ptype, target_type); mtrigger) {
+										interp_result = trigger::evaluate_additive_modifier(state, mtrigger, trigger::to_generic(p), trigger::to_generic(p), 0);
+									}
+									state.record_jit_comparison(llvm_result, interp_result);
 								}
-								assert(llvm_result == interp_result);
-#endif
 								auto chance = llvm_result + (target_type == promoted_type ? promotion_bonus : 0.0f);
 								chances_total += chance;
 								weights[target_type] = chance;
@@ -3279,10 +3401,10 @@ dcon::province_id get_province_target_in_nation(sys::state& state, dcon::nation_
 					using ftype = float(*)(int32_t, int32_t);
 					ftype fn = (ftype)modifier_fn;
 					float llvm_result = fn(loc.get_province().id.index(), p.index());
-#ifdef CHECK_LLVM_RESULTS
-					float interp_result = trigger::evaluate_multiplicative_modifier(state, modifier, trigger::to_generic(loc.get_province().id), trigger::to_generic(p), 0);
-					assert(llvm_result == interp_result);
-#endif
+					if(state.jit_compare_mode.load(std::memory_order_relaxed)) {
+						float interp_result = trigger::evaluate_multiplicative_modifier(state, modifier, trigger::to_generic(loc.get_province().id), trigger::to_generic(p), 0);
+						state.record_jit_comparison(llvm_result, interp_result);
+					}
 					weight = std::max(0.0f, llvm_result * (loc.get_province().get_modifier_values(sys::provincial_mod_offsets::immigrant_attract) + 1.0f));
 				} else {
 					float interp_result = trigger::evaluate_multiplicative_modifier(state, modifier, trigger::to_generic(loc.get_province().id), trigger::to_generic(p), 0);
@@ -3338,10 +3460,10 @@ dcon::province_id get_colonial_province_target_in_nation(sys::state& state, dcon
 					using ftype = float(*)(int32_t, int32_t);
 					ftype fn = (ftype)modifier_fn;
 					float llvm_result = fn(loc.get_province().id.index(), p.index());
-#ifdef CHECK_LLVM_RESULTS
-					float interp_result = trigger::evaluate_multiplicative_modifier(state, modifier, trigger::to_generic(loc.get_province().id), trigger::to_generic(p), 0);
-					assert(llvm_result == interp_result);
-#endif
+					if(state.jit_compare_mode.load(std::memory_order_relaxed)) {
+						float interp_result = trigger::evaluate_multiplicative_modifier(state, modifier, trigger::to_generic(loc.get_province().id), trigger::to_generic(p), 0);
+						state.record_jit_comparison(llvm_result, interp_result);
+					}
 					weight = std::max(0.0f, llvm_result * (loc.get_province().get_modifier_values(sys::provincial_mod_offsets::immigrant_attract) + 1.0f));
 				} else {
 					float interp_result = trigger::evaluate_multiplicative_modifier(state, modifier, trigger::to_generic(loc.get_province().id), trigger::to_generic(p), 0);
@@ -3412,10 +3534,10 @@ dcon::nation_id get_immigration_target(sys::state& state, dcon::nation_id owner,
 			using ftype = float(*)(int32_t, int32_t);
 			ftype fn = (ftype)modifier_fn;
 			float llvm_result = fn(inner.index(), p.index());
-#ifdef CHECK_LLVM_RESULTS
-			float interp_result = trigger::evaluate_multiplicative_modifier(state, modifier, trigger::to_generic(inner), trigger::to_generic(p), 0);
-			assert( llvm_result == interp_result);
-#endif
+			if(state.jit_compare_mode.load(std::memory_order_relaxed)) {
+				float interp_result = trigger::evaluate_multiplicative_modifier(state, modifier, trigger::to_generic(inner), trigger::to_generic(p), 0);
+				state.record_jit_comparison(llvm_result, interp_result);
+			}
 			weight = std::max(0.0f, llvm_result * std::max(0.f, (state.world.nation_get_modifier_values(inner, sys::national_mod_offsets::global_immigrant_attract) + 1.0f)));
 		} else {
 			float interp_result = trigger::evaluate_multiplicative_modifier(state, modifier, trigger::to_generic(inner), trigger::to_generic(p), 0);
@@ -3721,20 +3843,32 @@ float get_estimated_emigration(sys::state& state, dcon::pop_id ids) {
 }
 
 namespace impl {
-dcon::pop_id find_or_make_pop(sys::state& state, dcon::province_id loc, dcon::culture_id cid, dcon::religion_id rid,
-		dcon::pop_type_id ptid, float l) {
+dcon::pop_type_id local_pop_type(sys::state const& state, dcon::province_id loc, dcon::pop_type_id ptid) {
 	bool is_mine = state.world.commodity_get_is_mine(state.world.province_get_rgo(loc));
 	if(is_mine && ptid == state.culture_definitions.farmers) {
-		ptid = state.culture_definitions.laborers;
+		return state.culture_definitions.laborers;
 	} else if(!is_mine && ptid == state.culture_definitions.laborers) {
-		ptid = state.culture_definitions.farmers;
+		return state.culture_definitions.farmers;
 	}
-	// TODO: fix state capital only type pops ?
+	return ptid;
+}
+
+dcon::pop_id find_pop(sys::state const& state, dcon::province_id loc, dcon::culture_id cid, dcon::religion_id rid, dcon::pop_type_id ptid) {
+	ptid = local_pop_type(state, loc, ptid);
 	for(auto pl : state.world.province_get_pop_location(loc)) {
 		if(pl.get_pop().get_culture() == cid && pl.get_pop().get_religion() == rid && pl.get_pop().get_poptype() == ptid) {
 			return pl.get_pop();
 		}
 	}
+	return dcon::pop_id{};
+}
+
+dcon::pop_id find_or_make_pop(sys::state& state, dcon::province_id loc, dcon::culture_id cid, dcon::religion_id rid,
+		dcon::pop_type_id ptid, float l) {
+	// TODO: fix state capital only type pops ?
+	if(auto existing = find_pop(state, loc, cid, rid, ptid); existing)
+		return existing;
+	ptid = local_pop_type(state, loc, ptid);
 	auto np = fatten(state.world, state.world.create_pop());
 	state.world.force_create_pop_location(np, loc);
 	np.set_culture(cid);
@@ -3826,22 +3960,28 @@ dcon::pop_id find_or_make_pop(sys::state& state, dcon::province_id loc, dcon::cu
 }
 } // namespace impl
 
-void apply_type_changes(sys::state& state, uint32_t offset, uint32_t divisions, promotion_buffer& pbuf) {
+void queue_pop_transfer(sys::state& state, pop_transfer_buffer& tbuf, dcon::pop_id source, dcon::province_id loc, dcon::culture_id cid,
+		dcon::religion_id rid, dcon::pop_type_id ptid, float amount, pop_transfer_kind kind) {
+	// only existing pops are looked up here; pops are never created while the stages run
+	auto target = impl::find_pop(state, loc, cid, rid, ptid);
+	state.world.pop_get_size(source) -= amount;
+	tbuf.transfers.push_back(pop_transfer{ source, target, loc, cid, rid, ptid, pop_demographics::get_literacy(state, source), amount, kind });
+}
+
+void apply_type_changes(sys::state& state, uint32_t offset, uint32_t divisions, promotion_buffer& pbuf, pop_transfer_buffer& tbuf) {
 	execute_staggered_blocks(offset, divisions, std::min(state.world.pop_size(), pbuf.size), [&](auto ids) {
 		ve::apply(
 				[&](dcon::pop_id p) {
 					if(pbuf.amounts.get(p) > 0.0f && pbuf.types.get(p)) {
-						auto target_pop = impl::find_or_make_pop(state, state.world.pop_get_province_from_pop_location(p),
-								state.world.pop_get_culture(p), state.world.pop_get_religion(p), pbuf.types.get(p), pop_demographics::get_literacy(state, p));
-						state.world.pop_get_size(p) -= pbuf.amounts.get(p);
-						state.world.pop_get_size(target_pop) += pbuf.amounts.get(p);
+						queue_pop_transfer(state, tbuf, p, state.world.pop_get_province_from_pop_location(p), state.world.pop_get_culture(p),
+								state.world.pop_get_religion(p), pbuf.types.get(p), pbuf.amounts.get(p), pop_transfer_kind::change);
 					}
 				},
 				ids);
 	});
 }
 
-void apply_assimilation(sys::state& state, uint32_t offset, uint32_t divisions, assimilation_buffer& pbuf) {
+void apply_assimilation(sys::state& state, uint32_t offset, uint32_t divisions, assimilation_buffer& pbuf, pop_transfer_buffer& tbuf) {
 	auto exec_fn = [&](auto ids) {
 		auto locs = state.world.pop_get_province_from_pop_location(ids);
 		ve::apply([&](dcon::pop_id p, dcon::province_id l, dcon::culture_id dac) {
@@ -3852,9 +3992,7 @@ void apply_assimilation(sys::state& state, uint32_t offset, uint32_t divisions,
 					? state.world.nation_get_religion(nations::owner_of_pop(state, p))
 					: state.world.province_get_dominant_religion(l);
 				assert(state.world.pop_get_poptype(p));
-				auto target_pop = impl::find_or_make_pop(state, l, cul, rel, state.world.pop_get_poptype(p), pop_demographics::get_literacy(state, p));
-				state.world.pop_get_size(p) -= pbuf.amounts.get(p);
-				state.world.pop_get_size(target_pop) += pbuf.amounts.get(p);
+				queue_pop_transfer(state, tbuf, p, l, cul, rel, state.world.pop_get_poptype(p), pbuf.amounts.get(p), pop_transfer_kind::change);
 			}
 		},
 		ids, locs, state.world.province_get_dominant_accepted_culture(locs));
@@ -3862,70 +4000,78 @@ void apply_assimilation(sys::state& state, uint32_t offset, uint32_t divisions,
 	execute_staggered_blocks(offset, divisions, std::min(state.world.pop_size(), pbuf.size), exec_fn);
 }
 
-void apply_internal_migration(sys::state& state, uint32_t offset, uint32_t divisions, migration_buffer& pbuf) {
+void apply_internal_migration(sys::state& state, uint32_t offset, uint32_t divisions, migration_buffer& pbuf, pop_transfer_buffer& tbuf) {
 	execute_staggered_blocks(offset, divisions, std::min(state.world.pop_size(), pbuf.size), [&](auto ids) {
 		ve::apply(
 				[&](dcon::pop_id p) {
 					if(pbuf.amounts.get(p) > 0.0f && pbuf.destinations.get(p)) {
 						assert(state.world.pop_get_poptype(p));
-						auto target_pop = impl::find_or_make_pop(state, pbuf.destinations.get(p), state.world.pop_get_culture(p),
-								state.world.pop_get_religion(p), state.world.pop_get_poptype(p), pop_demographics::get_literacy(state, p));
-						state.world.pop_get_size(p) -= pbuf.amounts.get(p);
-						state.world.pop_get_size(target_pop) += pbuf.amounts.get(p);
-						state.world.province_get_daily_net_migration(state.world.pop_get_province_from_pop_location(p)) -=
-								pbuf.amounts.get(p);
-						state.world.province_get_daily_net_migration(pbuf.destinations.get(p)) += pbuf.amounts.get(p);
+						queue_pop_transfer(state, tbuf, p, pbuf.destinations.get(p), state.world.pop_get_culture(p), state.world.pop_get_religion(p),
+								state.world.pop_get_poptype(p), pbuf.amounts.get(p), pop_transfer_kind::migration);
 					}
 				},
 				ids);
 	});
 }
 
-void apply_colonial_migration(sys::state& state, uint32_t offset, uint32_t divisions, migration_buffer& pbuf) {
+void apply_colonial_migration(sys::state& state, uint32_t offset, uint32_t divisions, migration_buffer& pbuf, pop_transfer_buffer& tbuf) {
 	execute_staggered_blocks(offset, divisions, std::min(state.world.pop_size(), pbuf.size), [&](auto ids) {
 		ve::apply(
 				[&](dcon::pop_id p) {
 					if(pbuf.amounts.get(p) > 0.0f && pbuf.destinations.get(p)) {
 						assert(state.world.pop_get_poptype(p));
-						auto target_pop = impl::find_or_make_pop(state, pbuf.destinations.get(p), state.world.pop_get_culture(p),
-								state.world.pop_get_religion(p), state.world.pop_get_poptype(p), pop_demographics::get_literacy(state, p));
-						state.world.pop_get_size(p) -= pbuf.amounts.get(p);
-						state.world.pop_get_size(target_pop) += pbuf.amounts.get(p);
-						state.world.province_get_daily_net_migration(state.world.pop_get_province_from_pop_location(p)) -=
-								pbuf.amounts.get(p);
-						state.world.province_get_daily_net_migration(pbuf.destinations.get(p)) += pbuf.amounts.get(p);
+						queue_pop_transfer(state, tbuf, p, pbuf.destinations.get(p), state.world.pop_get_culture(p), state.world.pop_get_religion(p),
+								state.world.pop_get_poptype(p), pbuf.amounts.get(p), pop_transfer_kind::migration);
 					}
 				},
 				ids);
 	});
 }
 
-void apply_immigration(sys::state& state, uint32_t offset, uint32_t divisions, migration_buffer& pbuf) {
+void apply_immigration(sys::state& state, uint32_t offset, uint32_t divisions, migration_buffer& pbuf, pop_transfer_buffer& tbuf) {
 	execute_staggered_blocks(offset, divisions, std::min(state.world.pop_size(), pbuf.size), [&](auto ids) {
 		ve::apply(
 				[&](dcon::pop_id p) {
 					auto amount = pbuf.amounts.get(p);
 					if(amount > 0.0f && pbuf.destinations.get(p)) {
 						assert(state.world.pop_get_poptype(p));
-						auto target_pop = impl::find_or_make_pop(state, pbuf.destinations.get(p), state.world.pop_get_culture(p),
-								state.world.pop_get_religion(p), state.world.pop_get_poptype(p), pop_demographics::get_literacy(state, p));
-
-						state.world.pop_get_size(p) -= amount;
-						state.world.pop_get_size(target_pop) += amount;
-						state.world.province_get_daily_net_immigration(state.world.pop_get_province_from_pop_location(p)) -= amount;
-						state.world.province_get_daily_net_immigration(pbuf.destinations.get(p)) += amount;
-						state.world.province_set_last_immigration(pbuf.destinations.get(p), state.current_date);
+						queue_pop_transfer(state, tbuf, p, pbuf.destinations.get(p), state.world.pop_get_culture(p), state.world.pop_get_religion(p),
+								state.world.pop_get_poptype(p), amount, pop_transfer_kind::immigration);
 					}
 				},
 				ids);
 	});
 }
 
+void merge_pop_transfers(sys::state& state, pop_transfer_buffer& tbuf) {
+	for(auto& t : tbuf.transfers) {
+		// a target missing during the stage may have been created by an earlier transfer of the merge
+		auto target = t.target ? t.target : impl::find_or_make_pop(state, t.location, t.culture, t.religion, t.type, t.literacy);
+		state.world.pop_get_size(target) += t.amount;
+
+		switch(t.kind) {
+		case pop_transfer_kind::migration:
+			state.world.province_get_daily_net_migration(state.world.pop_get_province_from_pop_location(t.source)) -= t.amount;
+			state.world.province_get_daily_net_migration(t.location) += t.amount;
+			break;
+		case pop_transfer_kind::immigration:
+			state.world.province_get_daily_net_immigration(state.world.pop_get_province_from_pop_location(t.source)) -= t.amount;
+			state.world.province_get_daily_net_immigration(t.location) += t.amount;
+			state.world.province_set_last_immigration(t.location, state.current_date);
+			break;
+		default:
+			break;
+		}
+	}
+	tbuf.transfers.clear();
+}
+
 void remove_size_zero_pops(sys::state& state) {
 	// IMPORTANT: we count down here so that we can delete as we go, compacting from the end
 	for(auto last = state.world.pop_size(); last-- > 0;) {
 		dcon::pop_id m{dcon::pop_id::value_base_t(last)};
 		if(state.world.pop_get_size(m) < 1.0f) {
+			remove_pop_contribution(state, m);
 			state.world.delete_pop(m);
 		}
 	}
@@ -3936,11 +4082,102 @@ void remove_small_pops(sys::state& state) {
 	for(auto last = state.world.pop_size(); last-- > 0;) {
 		dcon::pop_id m{ dcon::pop_id::value_base_t(last) };
 		if(state.world.pop_get_size(m) < 20.0f) {
+			remove_pop_contribution(state, m);
 			state.world.delete_pop(m);
 		}
 	}
 }
 
+// must match the size of the pop object in dcon_generated.txt
+constexpr uint32_t pop_capacity = 300000;
+
+void compact_pops(sys::state& state) {
+	auto old_count = state.world.pop_size();
+	// the new copies are made before the old pops are deleted, so both sets must fit at once
+	if(old_count == 0 || old_count * 2 > pop_capacity)
+		return;
+
+	// order by location, ties broken by the current id, so that every client produces the same layout
+	std::vector<std::pair<uint32_t, uint32_t>> order;
+	order.reserve(old_count);
+	for(uint32_t i = 0; i < old_count; ++i) {
+		dcon::pop_id p{ dcon::pop_id::value_base_t(i) };
+		order.emplace_back(uint32_t(state.world.pop_get_province_from_pop_location(p).index()), i);
+	}
+	std::sort(order.begin(), order.end());
+
+	bool already_ordered = true;
+	for(uint32_t i = 0; i < old_count; ++i) {
+		if(order[i].second != i) {
+			already_ordered = false;
+			break;
+		}
+	}
+	if(already_ordered)
+		return;
+
+	auto demo_size = pop_demographics::size(state);
+	std::vector<dcon::regiment_source_id> regiments;
+	std::vector<dcon::province_land_construction_id> constructions;
+	for(auto& [prov, index] : order) {
+		dcon::pop_id o{ dcon::pop_id::value_base_t(index) };
+		auto n = state.world.create_pop();
+
+		state.world.pop_set_poptype(n, state.world.pop_get_poptype(o));
+		state.world.pop_set_religion(n, state.world.pop_get_religion(o));
+		state.world.pop_set_culture(n, state.world.pop_get_culture(o));
+		state.world.pop_set_size(n, state.world.pop_get_size(o));
+		state.world.pop_set_savings(n, state.world.pop_get_savings(o));
+		state.world.pop_set_uconsciousness(n, state.world.pop_get_uconsciousness(o));
+		state.world.pop_set_umilitancy(n, state.world.pop_get_umilitancy(o));
+		state.world.pop_set_uliteracy(n, state.world.pop_get_uliteracy(o));
+		state.world.pop_set_uemployment(n, state.world.pop_get_uemployment(o));
+		state.world.pop_set_ulife_needs_satisfaction(n, state.world.pop_get_ulife_needs_satisfaction(o));
+		state.world.pop_set_ueveryday_needs_satisfaction(n, state.world.pop_get_ueveryday_needs_satisfaction(o));
+		state.world.pop_set_uluxury_needs_satisfaction(n, state.world.pop_get_uluxury_needs_satisfaction(o));
+		state.world.pop_set_upolitical_reform_desire(n, state.world.pop_get_upolitical_reform_desire(o));
+		state.world.pop_set_usocial_reform_desire(n, state.world.pop_get_usocial_reform_desire(o));
+		for(uint32_t k = 0; k < demo_size; ++k) {
+			dcon::pop_demographics_key key{ dcon::pop_demographics_key::value_base_t(k) };
+			state.world.pop_set_udemographics(n, key, state.world.pop_get_udemographics(o, key));
+		}
+		state.world.pop_set_dominant_ideology(n, state.world.pop_get_dominant_ideology(o));
+		state.world.pop_set_dominant_issue_option(n, state.world.pop_get_dominant_issue_option(o));
+		state.world.pop_set_is_primary_or_accepted_culture(n, state.world.pop_get_is_primary_or_accepted_culture(o));
+		state.world.pop_set_demo_tracked_size(n, state.world.pop_get_demo_tracked_size(o));
+		state.world.pop_set_demo_tracked_location(n, state.world.pop_get_demo_tracked_location(o));
+		state.world.pop_set_demo_tracked_poptype(n, state.world.pop_get_demo_tracked_poptype(o));
+		state.world.pop_set_demo_tracked_culture(n, state.world.pop_get_demo_tracked_culture(o));
+		state.world.pop_set_demo_tracked_religion(n, state.world.pop_get_demo_tracked_religion(o));
+
+		if(auto loc = state.world.pop_get_province_from_pop_location(o); loc)
+			state.world.force_create_pop_location(n, loc);
+		if(auto m = state.world.pop_get_movement_from_pop_movement_membership(o); m)
+			state.world.force_create_pop_movement_membership(n, m);
+		if(auto r = state.world.pop_get_rebel_faction_from_pop_rebellion_membership(o); r)
+			state.world.force_create_pop_rebellion_membership(n, r);
+
+		// re-linking shrinks the ranges, so collect them first
+		regiments.clear();
+		for(auto rs : state.world.pop_get_regiment_source(o))
+			regiments.push_back(rs.id);
+		for(auto rs : regiments)
+			state.world.regiment_source_set_pop(rs, n);
+		constructions.clear();
+		for(auto c : state.world.pop_get_province_land_construction(o))
+			constructions.push_back(c.id);
+		for(auto c : constructions)
+			state.world.province_land_construction_set_pop(c, n);
+	}
+
+	// IMPORTANT: deleting from the last old pop down moves the copies, last one first, into the freed slots,
+	// which leaves the copy made in position i at index i
+	for(auto last = old_count; last-- > 0;) {
+		state.world.delete_pop(dcon::pop_id{ dcon::pop_id::value_base_t(last) });
+	}
+	assert(state.world.pop_size() == old_count);
+}
+
 float calculate_nation_sol(sys::state& state, dcon::nation_id nation_id) {
 	auto pln = state.world.nation_get_demographics(nation_id, demographics::poor_life_needs);
 	auto mln = state.world.nation_get_demographics(nation_id, demographics::middle_life_needs);
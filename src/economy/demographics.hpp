@@ -182,6 +182,10 @@ void regenerate_from_pop_data_full(sys::state& state);
 void alt_regenerate_from_pop_data_full(sys::state& state);
 void regenerate_from_pop_data_daily(sys::state& state);
 void alt_regenerate_from_pop_data_daily(sys::state& state);
+// whether the synchronous daily update folds pop changes into the aggregates instead of summing every pop
+bool incremental_aggregation_active(sys::state const& state);
+// must be called before a pop is deleted outside of the daily update, so that its contribution is taken back
+void remove_pop_contribution(sys::state& state, dcon::pop_id p);
 
 void alt_demographics_update_extras(sys::state& state);
 
@@ -272,6 +276,25 @@ struct migration_buffer {
 	}
 };
 
+enum class pop_transfer_kind : uint8_t { change, migration, immigration };
+
+// part of a pop moving into another pop; the target is created when the transfers are merged if it did not exist yet
+struct pop_transfer {
+	dcon::pop_id source;
+	dcon::pop_id target;
+	dcon::province_id location;
+	dcon::culture_id culture;
+	dcon::religion_id religion;
+	dcon::pop_type_id type;
+	float literacy = 0.0f;
+	float amount = 0.0f;
+	pop_transfer_kind kind = pop_transfer_kind::change;
+};
+
+struct pop_transfer_buffer {
+	std::vector<pop_transfer> transfers;
+};
+
 void update_literacy(sys::state& state, uint32_t offset, uint32_t divisions);
 void update_consciousness(sys::state& state, uint32_t offset, uint32_t divisions);
 void update_militancy(sys::state& state, uint32_t offset, uint32_t divisions);
@@ -291,14 +314,20 @@ float get_estimated_promotion(sys::state& state, dcon::nation_id n);
 
 void apply_ideologies(sys::state& state, uint32_t offset, uint32_t divisions, ideology_buffer& pbuf);
 void apply_issues(sys::state& state, uint32_t offset, uint32_t divisions, issues_buffer& pbuf);
-void apply_type_changes(sys::state& state, uint32_t offset, uint32_t divisions, promotion_buffer& pbuf);
-void apply_assimilation(sys::state& state, uint32_t offset, uint32_t divisions, assimilation_buffer& pbuf);
-void apply_internal_migration(sys::state& state, uint32_t offset, uint32_t divisions, migration_buffer& pbuf);
-void apply_colonial_migration(sys::state& state, uint32_t offset, uint32_t divisions, migration_buffer& pbuf);
-void apply_immigration(sys::state& state, uint32_t offset, uint32_t divisions, migration_buffer& pbuf);
+// these only take the moved amounts out of the source pops and queue the transfers, so that they can run at the same time
+// (their blocks of source pops never overlap); merge_pop_transfers must then be called on each buffer in a fixed order
+void apply_type_changes(sys::state& state, uint32_t offset, uint32_t divisions, promotion_buffer& pbuf, pop_transfer_buffer& tbuf);
+void apply_assimilation(sys::state& state, uint32_t offset, uint32_t divisions, assimilation_buffer& pbuf, pop_transfer_buffer& tbuf);
+void apply_internal_migration(sys::state& state, uint32_t offset, uint32_t divisions, migration_buffer& pbuf, pop_transfer_buffer& tbuf);
+void apply_colonial_migration(sys::state& state, uint32_t offset, uint32_t divisions, migration_buffer& pbuf, pop_transfer_buffer& tbuf);
+void apply_immigration(sys::state& state, uint32_t offset, uint32_t divisions, migration_buffer& pbuf, pop_transfer_buffer& tbuf);
+// adds the queued amounts to their targets, creating the missing ones in queue order
+void merge_pop_transfers(sys::state& state, pop_transfer_buffer& tbuf);
 
 void remove_size_zero_pops(sys::state& state);
 void remove_small_pops(sys::state& state);
+// renumbers the pops so that the pops of each province are stored next to each other, in province order
+void compact_pops(sys::state& state);
 
 float get_monthly_pop_increase(sys::state& state, dcon::pop_id);
 int64_t get_monthly_pop_increase(sys::state& state, dcon::nation_id n);
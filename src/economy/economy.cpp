@@ -5423,7 +5423,10 @@ void daily_update(sys::state& state, bool presimulation, float presimulation_sta
 		}
 	});
 
-	populate_construction_consumption(state);
+	{
+		sys::tick_phase_scope phase{ state.tick_profile, "economy_populate_construction_consumption", sys::tick_phase_kind::nested };
+		populate_construction_consumption(state);
+	}
 
 	sanity_check(state);
 
@@ -5491,135 +5494,175 @@ void daily_update(sys::state& state, bool presimulation, float presimulation_sta
 		}, ids);
 	});
 
-	// update trade volume based on potential profits right at the start
-	// we can't put it between demand and supply generation!
-	concurrency::parallel_for(uint32_t(0), total_commodities, [&](uint32_t k) {
-		dcon::commodity_id c{ dcon::commodity_id::value_base_t(k) };
+	sys::tick_phase_scope trade_volume_phase{ state.tick_profile, "economy_trade_volume", sys::tick_phase_kind::nested };
 
-		if(state.world.commodity_get_money_rgo(c)) {
-			return;
-		}
+	// everything about a trade route that does not depend on the commodity is computed once per route here
+	// instead of once per route and commodity in the commodity loop below
 
-		state.world.execute_serial_over_trade_route([&](auto trade_route) {
-			auto current_volume = state.world.trade_route_get_volume(trade_route, c);
-			auto A = ve::apply([&](auto route) {
-				return state.world.trade_route_get_connected_markets(route, 0);
-			}, trade_route);
+	auto route_origin = ve::vectorizable_buffer<dcon::market_id, dcon::trade_route_id>(state.world.trade_route_size());
+	auto route_target = ve::vectorizable_buffer<dcon::market_id, dcon::trade_route_id>(state.world.trade_route_size());
+	auto route_merchant_cut = ve::vectorizable_buffer<float, dcon::trade_route_id>(state.world.trade_route_size());
+	auto route_import_tariff_A = ve::vectorizable_buffer<float, dcon::trade_route_id>(state.world.trade_route_size());
+	auto route_export_tariff_A = ve::vectorizable_buffer<float, dcon::trade_route_id>(state.world.trade_route_size());
+	auto route_import_tariff_B = ve::vectorizable_buffer<float, dcon::trade_route_id>(state.world.trade_route_size());
+	auto route_export_tariff_B = ve::vectorizable_buffer<float, dcon::trade_route_id>(state.world.trade_route_size());
+	// 1 where the route is broken by a war or an embargo: whatever the prices, its volumes drop to zero
+	auto route_blocked = ve::vectorizable_buffer<float, dcon::trade_route_id>(state.world.trade_route_size());
 
-			auto B = ve::apply([&](auto route) {
-				return state.world.trade_route_get_connected_markets(route, 1);
-			}, trade_route);
+	state.world.execute_parallel_over_trade_route([&](auto trade_route) {
+		auto A = ve::apply([&](auto route) {
+			return state.world.trade_route_get_connected_markets(route, 0);
+		}, trade_route);
 
-			auto absolute_volume = ve::abs(current_volume);
-			//auto sat = state.world.market_get_direct_demand_satisfaction(origin, c);
+		auto B = ve::apply([&](auto route) {
+			return state.world.trade_route_get_connected_markets(route, 1);
+		}, trade_route);
 
-			auto s_A = state.world.market_get_zone_from_local_market(A);
-			auto s_B = state.world.market_get_zone_from_local_market(B);
+		route_origin.set(trade_route, A);
+		route_target.set(trade_route, B);
 
-			auto n_A = state.world.state_instance_get_nation_from_state_ownership(s_A);
-			auto n_B = state.world.state_instance_get_nation_from_state_ownership(s_B);
+		auto s_A = state.world.market_get_zone_from_local_market(A);
+		auto s_B = state.world.market_get_zone_from_local_market(B);
 
-			auto capital_A = state.world.state_instance_get_capital(s_A);
-			auto capital_B = state.world.state_instance_get_capital(s_B);
-			
-			auto port_A = coastal_capital_buffer.get(s_A);
-			auto port_B = coastal_capital_buffer.get(s_B);
+		auto n_A = state.world.state_instance_get_nation_from_state_ownership(s_A);
+		auto n_B = state.world.state_instance_get_nation_from_state_ownership(s_B);
 
-			auto controller_capital_A = state.world.province_get_nation_from_province_control(capital_A);
-			auto controller_capital_B = state.world.province_get_nation_from_province_control(capital_B);
+		auto capital_A = state.world.state_instance_get_capital(s_A);
+		auto capital_B = state.world.state_instance_get_capital(s_B);
 
-			auto controller_port_A = state.world.province_get_nation_from_province_control(port_A);
-			auto controller_port_B = state.world.province_get_nation_from_province_control(port_B);
+		auto port_A = coastal_capital_buffer.get(s_A);
+		auto port_B = coastal_capital_buffer.get(s_B);
 
-			auto sphere_A = state.world.nation_get_in_sphere_of(controller_capital_A);
-			auto sphere_B = state.world.nation_get_in_sphere_of(controller_capital_B);
+		auto controller_capital_A = state.world.province_get_nation_from_province_control(capital_A);
+		auto controller_capital_B = state.world.province_get_nation_from_province_control(capital_B);
 
-			auto overlord_A = state.world.overlord_get_ruler(
-				state.world.nation_get_overlord_as_subject(controller_capital_A)
-			);
-			auto overlord_B = state.world.overlord_get_ruler(
-				state.world.nation_get_overlord_as_subject(controller_capital_B)
-			);
+		auto controller_port_A = state.world.province_get_nation_from_province_control(port_A);
+		auto controller_port_B = state.world.province_get_nation_from_province_control(port_B);
+
+		auto sphere_A = state.world.nation_get_in_sphere_of(controller_capital_A);
+		auto sphere_B = state.world.nation_get_in_sphere_of(controller_capital_B);
 
-			// TODO: expand to actual trade agreements
-			auto A_is_open_to_B = sphere_A == controller_capital_B || overlord_A == controller_capital_B;
-			auto B_is_open_to_A = sphere_B == controller_capital_A || overlord_B == controller_capital_A;
+		auto overlord_A = state.world.overlord_get_ruler(
+			state.world.nation_get_overlord_as_subject(controller_capital_A)
+		);
+		auto overlord_B = state.world.overlord_get_ruler(
+			state.world.nation_get_overlord_as_subject(controller_capital_B)
+		);
 
-			// sphere joins embargo
-			// subject joins embargo
-			// TODO: make into diplomatic interaction
+		// TODO: expand to actual trade agreements
+		auto A_is_open_to_B = sphere_A == controller_capital_B || overlord_A == controller_capital_B;
+		auto B_is_open_to_A = sphere_B == controller_capital_A || overlord_B == controller_capital_A;
 
-			auto A_joins_sphere_wide_embargo = ve::apply([&](auto n_a, auto n_b) {
-				return military::are_at_war(state, n_a, n_b);
-			}, sphere_A, controller_capital_B);
+		// sphere joins embargo
+		// subject joins embargo
+		// TODO: make into diplomatic interaction
 
-			auto B_joins_sphere_wide_embargo = ve::apply([&](auto n_a, auto n_b) {
-				return military::are_at_war(state, n_a, n_b);
-			}, sphere_B, controller_capital_A);
+		auto A_joins_sphere_wide_embargo = ve::apply([&](auto n_a, auto n_b) {
+			return military::are_at_war(state, n_a, n_b);
+		}, sphere_A, controller_capital_B);
 
-			// these are not needed at the moment
-			// because overlord and subject are always in the same war
+		auto B_joins_sphere_wide_embargo = ve::apply([&](auto n_a, auto n_b) {
+			return military::are_at_war(state, n_a, n_b);
+		}, sphere_B, controller_capital_A);
 
-			/*
-			auto A_joins_overlord_embargo = ve::apply([&](auto n_a, auto n_b) {
-				return military::are_at_war(state, n_a, n_b);
-			}, overlord_A, controller_capital_B);
+		// these are not needed at the moment
+		// because overlord and subject are always in the same war
 
-			auto B_joins_overlord_embargo = ve::apply([&](auto n_a, auto n_b) {
-				return military::are_at_war(state, n_a, n_b);
-			}, overlord_B, controller_capital_A);
-			*/
+		/*
+		auto A_joins_overlord_embargo = ve::apply([&](auto n_a, auto n_b) {
+			return military::are_at_war(state, n_a, n_b);
+		}, overlord_A, controller_capital_B);
 
-			// if market capital controller is at war with market coastal controller is different
-			// or it's actually blockaded
-			// consider province blockaded
+		auto B_joins_overlord_embargo = ve::apply([&](auto n_a, auto n_b) {
+			return military::are_at_war(state, n_a, n_b);
+		}, overlord_B, controller_capital_A);
+		*/
 
-			ve::mask_vector port_occupied_A = ve::apply([&](auto n_a, auto n_b) {
-				return military::are_at_war(state, n_a, n_b);
-			}, controller_capital_A, controller_port_A);
-			ve::mask_vector port_occupied_B = ve::apply([&](auto n_a, auto n_b) {
-				return military::are_at_war(state, n_a, n_b);
-			}, controller_capital_B, controller_port_B);
+		// if market capital controller is at war with market coastal controller is different
+		// or it's actually blockaded
+		// consider province blockaded
 
-			ve::mask_vector is_A_blockaded = state.world.province_get_is_blockaded(port_A) || port_occupied_A;
-			ve::mask_vector is_B_blockaded = state.world.province_get_is_blockaded(port_B) || port_occupied_B;
+		ve::mask_vector port_occupied_A = ve::apply([&](auto n_a, auto n_b) {
+			return military::are_at_war(state, n_a, n_b);
+		}, controller_capital_A, controller_port_A);
+		ve::mask_vector port_occupied_B = ve::apply([&](auto n_a, auto n_b) {
+			return military::are_at_war(state, n_a, n_b);
+		}, controller_capital_B, controller_port_B);
 
-			// if market capital controllers are at war then we will break the link
-			auto at_war = ve::apply([&](auto n_a, auto n_b) {
-				return military::are_at_war(state, n_a, n_b);
-			}, controller_capital_A, controller_capital_B);
+		ve::mask_vector is_A_blockaded = state.world.province_get_is_blockaded(port_A) || port_occupied_A;
+		ve::mask_vector is_B_blockaded = state.world.province_get_is_blockaded(port_B) || port_occupied_B;
 
-			// it created quite bad oscilation
-			// so i decided to transfer goods into stockpile directly
-			// and consider that all of them were sold at given price
-			//auto actually_bought_ratio_A = state.world.market_get_supply_sold_ratio(A, c);
-			//auto actually_bought_ratio_B = state.world.market_get_supply_sold_ratio(B, c);
+		// if market capital controllers are at war then we will break the link
+		auto at_war = ve::apply([&](auto n_a, auto n_b) {
+			return military::are_at_war(state, n_a, n_b);
+		}, controller_capital_A, controller_capital_B);
+
+		auto is_sea_route = state.world.trade_route_get_is_sea_route(trade_route);
+		auto is_land_route = state.world.trade_route_get_is_land_route(trade_route);
+
+		is_sea_route = is_sea_route && !is_A_blockaded && !is_B_blockaded;
+
+		auto same_nation = controller_capital_A == controller_capital_B;
+
+		route_merchant_cut.set(trade_route, ve::select(same_nation, ve::fp_vector{ 1.f + economy::merchant_cut_domestic }, ve::fp_vector{ 1.f + economy::merchant_cut_foreign }));
+
+		route_import_tariff_A.set(trade_route, ve::select(same_nation || A_is_open_to_B, ve::fp_vector{ 0.f }, import_tariff_buffer.get(n_A)));
+		route_export_tariff_A.set(trade_route, ve::select(same_nation || A_is_open_to_B, ve::fp_vector{ 0.f }, export_tariff_buffer.get(n_A)));
+		route_import_tariff_B.set(trade_route, ve::select(same_nation || B_is_open_to_A, ve::fp_vector{ 0.f }, import_tariff_buffer.get(n_B)));
+		route_export_tariff_B.set(trade_route, ve::select(same_nation || B_is_open_to_A, ve::fp_vector{ 0.f }, export_tariff_buffer.get(n_B)));
+
+		route_blocked.set(trade_route, ve::select(at_war || A_joins_sphere_wide_embargo || B_joins_sphere_wide_embargo, ve::fp_vector{ 1.f }, ve::fp_vector{ 0.f }));
+
+		ve::fp_vector distance = 999999.f;
+		auto land_distance = state.world.trade_route_get_land_distance(trade_route);
+		auto sea_distance = state.world.trade_route_get_sea_distance(trade_route);
+
+		distance = ve::select(is_land_route, ve::min(distance, land_distance), distance);
+		distance = ve::select(is_sea_route, ve::min(distance, sea_distance), distance);
+
+		state.world.trade_route_set_distance(trade_route, distance);
+	});
+
+	// update trade volume based on potential profits right at the start
+	// we can't put it between demand and supply generation!
+	concurrency::parallel_for(uint32_t(0), total_commodities, [&](uint32_t k) {
+		dcon::commodity_id c{ dcon::commodity_id::value_base_t(k) };
 
-			auto is_A_civ = state.world.nation_get_is_civilized(n_A);
-			auto is_B_civ = state.world.nation_get_is_civilized(n_B);
+		if(state.world.commodity_get_money_rgo(c)) {
+			return;
+		}
 
-			auto is_sea_route = state.world.trade_route_get_is_sea_route(trade_route);
-			auto is_land_route = state.world.trade_route_get_is_land_route(trade_route);
+		state.world.execute_serial_over_trade_route([&](auto trade_route) {
+			auto current_volume = state.world.trade_route_get_volume(trade_route, c);
+			auto blocked = route_blocked.get(trade_route) != 0.f;
 
-			is_sea_route = is_sea_route && !is_A_blockaded && !is_B_blockaded;
+			// blocked routes lose all of their volume (current_volume - current_volume is exactly zero):
+			// when a whole block of routes is blocked, none of the prices below are needed
+			if(ve::compress_mask(!blocked).v == 0) {
+				state.world.trade_route_set_volume(trade_route, c, ve::fp_vector{ 0.f });
+				return;
+			}
 
-			auto same_nation = controller_capital_A == controller_capital_B;
+			auto A = route_origin.get(trade_route);
+			auto B = route_target.get(trade_route);
 
-			auto merchant_cut = ve::select(same_nation, ve::fp_vector{ 1.f + economy::merchant_cut_domestic }, ve::fp_vector{ 1.f + economy::merchant_cut_foreign });
+			auto absolute_volume = ve::abs(current_volume);
+			//auto sat = state.world.market_get_direct_demand_satisfaction(origin, c);
 
-			auto import_tariff_A = ve::select(same_nation || A_is_open_to_B, ve::fp_vector{ 0.f }, import_tariff_buffer.get(n_A));
-			auto export_tariff_A = ve::select(same_nation || A_is_open_to_B, ve::fp_vector{ 0.f }, export_tariff_buffer.get(n_A));
-			auto import_tariff_B = ve::select(same_nation || B_is_open_to_A, ve::fp_vector{ 0.f }, import_tariff_buffer.get(n_B));
-			auto export_tariff_B = ve::select(same_nation || B_is_open_to_A, ve::fp_vector{ 0.f }, export_tariff_buffer.get(n_B));
+			// it created quite bad oscilation
+			// so i decided to transfer goods into stockpile directly
+			// and consider that all of them were sold at given price
+			//auto actually_bought_ratio_A = state.world.market_get_supply_sold_ratio(A, c);
+			//auto actually_bought_ratio_B = state.world.market_get_supply_sold_ratio(B, c);
 
-			ve::fp_vector distance = 999999.f;
-			auto land_distance = state.world.trade_route_get_land_distance(trade_route);
-			auto sea_distance = state.world.trade_route_get_sea_distance(trade_route);
+			auto merchant_cut = route_merchant_cut.get(trade_route);
 
-			distance = ve::select(is_land_route, ve::min(distance, land_distance), distance);
-			distance = ve::select(is_sea_route, ve::min(distance, sea_distance), distance);
+			auto import_tariff_A = route_import_tariff_A.get(trade_route);
+			auto export_tariff_A = route_export_tariff_A.get(trade_route);
+			auto import_tariff_B = route_import_tariff_B.get(trade_route);
+			auto export_tariff_B = route_export_tariff_B.get(trade_route);
 
-			state.world.trade_route_set_distance(trade_route, distance);
+			auto distance = state.world.trade_route_get_distance(trade_route);
 
 			auto trade_good_loss_mult = ve::max(0.f, 1.f - 0.0001f * distance);
 
@@ -5646,13 +5689,7 @@ void daily_update(sys::state& state, bool presimulation, float presimulation_sta
 			change = ve::select(current_profit_B_to_A > 0.f, -current_profit_B_to_A / price_B_export, change);
 			change = ve::min(ve::max(change, -max_change), max_change);
 			change = ve::select(none_is_profiable, -current_volume, change);
-			change = ve::select(
-				at_war
-				|| A_joins_sphere_wide_embargo
-				|| B_joins_sphere_wide_embargo,
-				-current_volume,
-				change
-			);
+			change = ve::select(blocked, -current_volume, change);
 
 			// trade slowly decays to create soft limit on transportation
 			// essentially, regularisation of trade weights
@@ -5706,6 +5743,8 @@ void daily_update(sys::state& state, bool presimulation, float presimulation_sta
 		}
 	});
 
+	trade_volume_phase.finish();
+
 	sanity_check(state);
 
 	static ve::vectorizable_buffer<float, dcon::nation_id> invention_count = state.world.nation_make_vectorizable_float_buffer();
@@ -6033,8 +6072,8 @@ void daily_update(sys::state& state, bool presimulation, float presimulation_sta
 	// STEP 3 update pops consumption:
 
 	// reset data first:
-	state.world.for_each_pop_type([&](auto pt) {
-		state.world.execute_serial_over_market([&](auto ids) {
+	state.world.execute_parallel_over_market([&](auto ids) {
+		state.world.for_each_pop_type([&](auto pt) {
 			state.world.market_set_life_needs_scale(ids, pt, 0.f);
 			state.world.market_set_everyday_needs_scale(ids, pt, 0.f);
 			state.world.market_set_luxury_needs_scale(ids, pt, 0.f);
@@ -6613,8 +6652,8 @@ void daily_update(sys::state& state, bool presimulation, float presimulation_sta
 	// finally we can move to production:
 	// reset supply:
 
-	state.world.for_each_commodity([&](dcon::commodity_id c) {
-		state.world.execute_serial_over_market([&](auto markets) {
+	state.world.execute_parallel_over_market([&](auto markets) {
+		state.world.for_each_commodity([&](dcon::commodity_id c) {
 			if(state.world.commodity_get_money_rgo(c)) {
 				state.world.market_set_supply(markets, c, ve::fp_vector{});
 			} else {
@@ -6636,6 +6675,7 @@ void daily_update(sys::state& state, bool presimulation, float presimulation_sta
 	// we can handle each trade good separately: they do not influence each other
 	// 
 	// register trade supply
+	sys::tick_phase_scope trade_supply_phase{ state.tick_profile, "economy_trade_supply", sys::tick_phase_kind::nested };
 	concurrency::parallel_for(uint32_t(1), total_commodities, [&](uint32_t k) {
 		dcon::commodity_id cid{ dcon::commodity_id::value_base_t(k) };
 
@@ -6659,10 +6699,12 @@ void daily_update(sys::state& state, bool presimulation, float presimulation_sta
 		});
 	});
 
+	trade_supply_phase.finish();
+
 	sanity_check(state);
 
 	// artisans production
-	state.world.execute_serial_over_market([&](auto ids) {
+	state.world.execute_parallel_over_market([&](auto ids) {
 		update_market_artisan_production(state, ids);
 	});
 
@@ -6674,7 +6716,7 @@ void daily_update(sys::state& state, bool presimulation, float presimulation_sta
 		auto const secondary_def = state.culture_definitions.secondary_factory_worker;
 		auto secondary_key = demographics::to_key(state, secondary_def);
 
-		state.world.execute_serial_over_market([&](auto ids) {
+		state.world.execute_parallel_over_market([&](auto ids) {
 			auto sid = state.world.market_get_zone_from_local_market(ids);
 
 			auto primary = state.world.state_instance_get_demographics(sid, primary_key);
@@ -6689,7 +6731,17 @@ void daily_update(sys::state& state, bool presimulation, float presimulation_sta
 
 	auto amount_of_nations = state.world.nation_size();
 
-	for (auto n : state.world.in_nation) {
+	sys::tick_phase_scope production_phase{ state.tick_profile, "economy_production_wages_and_taxes", sys::tick_phase_kind::nested };
+
+	// production, wages and taxes only touch the provinces, pops and markets of the states a nation owns, so nations are
+	// updated in parallel; construction is advanced serially in between because constructions can be in foreign states
+	// and take goods from the construction demand of foreign markets
+
+	concurrency::parallel_for(uint32_t(0), state.world.nation_size(), [&](uint32_t i) {
+		dcon::nation_id n{ dcon::nation_id::value_base_t(i) };
+		if(!state.world.nation_is_valid(n))
+			return;
+
 		auto const min_wage_factor = pop_min_wage_factor(state, n);
 
 		for(auto p : state.world.nation_get_province_ownership(n)) {
@@ -6975,13 +7027,21 @@ void daily_update(sys::state& state, bool presimulation, float presimulation_sta
 				}
 			});
 		}
+	});
 
+	for(auto n : state.world.in_nation) {
 		/* advance construction */
 		advance_construction(state, n);
 
 		if(presimulation) {
 			emulate_construction_demand(state, n);
 		}
+	}
+
+	concurrency::parallel_for(uint32_t(0), state.world.nation_size(), [&](uint32_t i) {
+		dcon::nation_id n{ dcon::nation_id::value_base_t(i) };
+		if(!state.world.nation_is_valid(n))
+			return;
 
 		/* collect and distribute money for private education and other abstracted spendings */
 		auto edu_money = 0.f;
@@ -7134,14 +7194,17 @@ void daily_update(sys::state& state, bool presimulation, float presimulation_sta
 			auto market = si.get_state().get_market_from_local_market();
 			rebalance_needs_weights(state, market);
 		}
-	};
-	state.world.execute_serial_over_market([&](auto ids) {
+	});
+
+	state.world.execute_parallel_over_market([&](auto ids) {
 		auto local_states = state.world.market_get_zone_from_local_market(ids);
 		auto nations = state.world.state_instance_get_nation_from_state_ownership(local_states);
 
 		adjust_artisan_balance(state, ids, nations);
 	});
 
+	production_phase.finish();
+
 	sanity_check(state);
 
 	/*
@@ -7177,7 +7240,7 @@ void daily_update(sys::state& state, bool presimulation, float presimulation_sta
 
 	// price of labor unskilled
 	{
-		state.world.execute_serial_over_market([&](auto ids) {
+		state.world.execute_parallel_over_market([&](auto ids) {
 			ve::fp_vector supply =
 				state.world.market_get_labor_unskilled_supply(ids)
 				+ price_rigging;
@@ -7223,7 +7286,7 @@ void daily_update(sys::state& state, bool presimulation, float presimulation_sta
 
 	// price of labor skilled
 	{
-		state.world.execute_serial_over_market([&](auto ids) {
+		state.world.execute_parallel_over_market([&](auto ids) {
 			ve::fp_vector supply =
 				state.world.market_get_labor_skilled_supply(ids)
 				+ price_rigging;
@@ -7267,13 +7330,13 @@ void daily_update(sys::state& state, bool presimulation, float presimulation_sta
 		});
 	}
 
-	state.world.execute_serial_over_market([&](auto ids) {
-		concurrency::parallel_for(uint32_t(1), total_commodities, [&](uint32_t k) {
+	state.world.execute_parallel_over_market([&](auto ids) {
+		for(uint32_t k = 1; k < total_commodities; ++k) {
 			dcon::commodity_id cid{ dcon::commodity_id::value_base_t(k) };
 
 			//handling gold cost separetely
 			if(state.world.commodity_get_money_rgo(cid)) {
-				return;
+				continue;
 			}
 
 			// dirty hack ...
@@ -7302,7 +7365,7 @@ void daily_update(sys::state& state, bool presimulation, float presimulation_sta
 
 			//the only purpose of upper price bound is to prevent float overflow
 			state.world.market_set_price(ids, cid, ve::min(ve::max(current_price, 0.001f), 1'000'000'000'000.f));
-		});
+		}
 	});
 
 	sanity_check(state);
@@ -7434,6 +7497,7 @@ void daily_update(sys::state& state, bool presimulation, float presimulation_sta
 	resolve_constructions(state);
 
 	if(!presimulation) {
+		sys::tick_phase_scope phase{ state.tick_profile, "economy_run_private_investment", sys::tick_phase_kind::nested };
 		run_private_investment(state);
 	}
 
@@ -8968,4 +9032,116 @@ float estimate_investment_pool_daily_loss(sys::state& state, dcon::nation_id n)
 	return state.world.nation_get_private_investment(n) * 0.001f;
 }
 
+namespace cached {
+
+template<typename F>
+float lookup(sys::state& state, dcon::nation_id n, estimate_type type, F&& compute) {
+	auto& cache = state.ui_estimates;
+	auto const index = size_t(n.index()) * size_t(estimate_type::count) + size_t(type);
+	if(cache.values.size() <= index) {
+		cache.values.resize(size_t(state.world.nation_size()) * size_t(estimate_type::count), 0.0f);
+		cache.generations.resize(size_t(state.world.nation_size()) * size_t(estimate_type::count), 0);
+		if(cache.values.size() <= index)
+			return compute();
+	}
+	if(cache.generations[index] != cache.generation) {
+		cache.values[index] = compute();
+		cache.generations[index] = cache.generation;
+	}
+	return cache.values[index];
+}
+
+float estimate_gold_income(sys::state& state, dcon::nation_id n) {
+	return lookup(state, n, estimate_type::gold_income, [&]() { return economy::estimate_gold_income(state, n); });
+}
+float estimate_tariff_import_income(sys::state& state, dcon::nation_id n) {
+	return lookup(state, n, estimate_type::tariff_import_income, [&]() { return economy::estimate_tariff_import_income(state, n); });
+}
+float estimate_tariff_export_income(sys::state& state, dcon::nation_id n) {
+	return lookup(state, n, estimate_type::tariff_export_income, [&]() { return economy::estimate_tariff_export_income(state, n); });
+}
+float estimate_social_spending(sys::state& state, dcon::nation_id n) {
+	return lookup(state, n, estimate_type::social_spending, [&]() { return economy::estimate_social_spending(state, n); });
+}
+float estimate_subsidy_spending(sys::state& state, dcon::nation_id n) {
+	return lookup(state, n, estimate_type::subsidy_spending, [&]() { return economy::estimate_subsidy_spending(state, n); });
+}
+float estimate_diplomatic_balance(sys::state& state, dcon::nation_id n) {
+	return lookup(state, n, estimate_type::diplomatic_balance, [&]() { return economy::estimate_diplomatic_balance(state, n); });
+}
+float estimate_diplomatic_income(sys::state& state, dcon::nation_id n) {
+	return lookup(state, n, estimate_type::diplomatic_income, [&]() { return economy::estimate_diplomatic_income(state, n); });
+}
+float estimate_diplomatic_expenses(sys::state& state, dcon::nation_id n) {
+	return lookup(state, n, estimate_type::diplomatic_expenses, [&]() { return economy::estimate_diplomatic_expenses(state, n); });
+}
+float estimate_domestic_investment(sys::state& state, dcon::nation_id n) {
+	return lookup(state, n, estimate_type::domestic_investment, [&]() { return economy::estimate_domestic_investment(state, n); });
+}
+float estimate_land_spending(sys::state& state, dcon::nation_id n) {
+	return lookup(state, n, estimate_type::land_spending, [&]() { return economy::estimate_land_spending(state, n); });
+}
+float estimate_naval_spending(sys::state& state, dcon::nation_id n) {
+	return lookup(state, n, estimate_type::naval_spending, [&]() { return economy::estimate_naval_spending(state, n); });
+}
+float estimate_construction_spending(sys::state& state, dcon::nation_id n) {
+	return lookup(state, n, estimate_type::construction_spending, [&]() { return economy::estimate_construction_spending(state, n); });
+}
+float estimate_private_construction_spendings(sys::state& state, dcon::nation_id n) {
+	return lookup(state, n, estimate_type::private_construction_spending, [&]() { return economy::estimate_private_construction_spendings(state, n); });
+}
+float estimate_war_subsidies_spending(sys::state& state, dcon::nation_id n) {
+	return lookup(state, n, estimate_type::war_subsidies_spending, [&]() { return economy::estimate_war_subsidies_spending(state, n); });
+}
+float estimate_reparations_spending(sys::state& state, dcon::nation_id n) {
+	return lookup(state, n, estimate_type::reparations_spending, [&]() { return economy::estimate_reparations_spending(state, n); });
+}
+float estimate_war_subsidies_income(sys::state& state, dcon::nation_id n) {
+	return lookup(state, n, estimate_type::war_subsidies_income, [&]() { return economy::estimate_war_subsidies_income(state, n); });
+}
+float estimate_reparations_income(sys::state& state, dcon::nation_id n) {
+	return lookup(state, n, estimate_type::reparations_income, [&]() { return economy::estimate_reparations_income(state, n); });
+}
+float estimate_overseas_penalty_spending(sys::state& state, dcon::nation_id n) {
+	return lookup(state, n, estimate_type::overseas_penalty_spending, [&]() { return economy::estimate_overseas_penalty_spending(state, n); });
+}
+float estimate_stockpile_filling_spending(sys::state& state, dcon::nation_id n) {
+	return lookup(state, n, estimate_type::stockpile_filling_spending, [&]() { return economy::estimate_stockpile_filling_spending(state, n); });
+}
+float estimate_subject_payments_paid(sys::state& state, dcon::nation_id n) {
+	return lookup(state, n, estimate_type::subject_payments_paid, [&]() { return economy::estimate_subject_payments_paid(state, n); });
+}
+float estimate_subject_payments_received(sys::state& state, dcon::nation_id n) {
+	return lookup(state, n, estimate_type::subject_payments_received, [&]() { return economy::estimate_subject_payments_received(state, n); });
+}
+float estimate_daily_income(sys::state& state, dcon::nation_id n) {
+	return lookup(state, n, estimate_type::daily_income, [&]() { return economy::estimate_daily_income(state, n); });
+}
+float estimate_pop_payouts_by_income_type(sys::state& state, dcon::nation_id n, culture::income_type in) {
+	switch(in) {
+	case culture::income_type::administration:
+		return lookup(state, n, estimate_type::administration_payouts, [&]() { return economy::estimate_pop_payouts_by_income_type(state, n, in); });
+	case culture::income_type::military:
+		return lookup(state, n, estimate_type::military_payouts, [&]() { return economy::estimate_pop_payouts_by_income_type(state, n, in); });
+	case culture::income_type::education:
+		return lookup(state, n, estimate_type::education_payouts, [&]() { return economy::estimate_pop_payouts_by_income_type(state, n, in); });
+	default:
+		return economy::estimate_pop_payouts_by_income_type(state, n, in);
+	}
+}
+float estimate_tax_income_by_strata(sys::state& state, dcon::nation_id n, culture::pop_strata ps) {
+	switch(ps) {
+	case culture::pop_strata::poor:
+		return lookup(state, n, estimate_type::poor_tax_income, [&]() { return economy::estimate_tax_income_by_strata(state, n, ps); });
+	case culture::pop_strata::middle:
+		return lookup(state, n, estimate_type::middle_tax_income, [&]() { return economy::estimate_tax_income_by_strata(state, n, ps); });
+	case culture::pop_strata::rich:
+		return lookup(state, n, estimate_type::rich_tax_income, [&]() { return economy::estimate_tax_income_by_strata(state, n, ps); });
+	default:
+		return economy::estimate_tax_income_by_strata(state, n, ps);
+	}
+}
+
+} // namespace cached
+
 } // namespace economy
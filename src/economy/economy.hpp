@@ -527,6 +527,83 @@ float estimate_subject_payments_received(sys::state& state, dcon::nation_id o);
 
 float estimate_daily_income(sys::state& state, dcon::nation_id n);
 
+//
+// Cached estimates for the user interface. Every budget line is drawn by several elements (the budget window, its tooltips and
+// the top bar), and each of them used to walk all provinces, pops and constructions again on every update. The cached versions
+// compute each value once per nation until the ui is told that the game state changed, which happens after every day and
+// after every batch of commands. They must only be used from the ui thread: the simulation has to call the functions above,
+// because the ui may fill the cache while a tick is changing the game state
+//
+
+enum class estimate_type : uint8_t {
+	gold_income,
+	tariff_import_income,
+	tariff_export_income,
+	social_spending,
+	poor_tax_income,
+	middle_tax_income,
+	rich_tax_income,
+	administration_payouts,
+	military_payouts,
+	education_payouts,
+	subsidy_spending,
+	diplomatic_balance,
+	diplomatic_income,
+	diplomatic_expenses,
+	domestic_investment,
+	land_spending,
+	naval_spending,
+	construction_spending,
+	private_construction_spending,
+	war_subsidies_spending,
+	reparations_spending,
+	war_subsidies_income,
+	reparations_income,
+	overseas_penalty_spending,
+	stockpile_filling_spending,
+	subject_payments_paid,
+	subject_payments_received,
+	daily_income,
+	count
+};
+
+struct estimate_cache {
+	std::vector<float> values;			 // nation index * estimate_type::count + estimate type
+	std::vector<uint32_t> generations; // the value is valid when it matches generation
+	uint32_t generation = 1;
+
+	void invalidate() {
+		++generation;
+	}
+};
+
+namespace cached {
+float estimate_gold_income(sys::state& state, dcon::nation_id n);
+float estimate_tariff_import_income(sys::state& state, dcon::nation_id n);
+float estimate_tariff_export_income(sys::state& state, dcon::nation_id n);
+float estimate_social_spending(sys::state& state, dcon::nation_id n);
+float estimate_pop_payouts_by_income_type(sys::state& state, dcon::nation_id n, culture::income_type in);
+float estimate_tax_income_by_strata(sys::state& state, dcon::nation_id n, culture::pop_strata ps);
+float estimate_subsidy_spending(sys::state& state, dcon::nation_id n);
+float estimate_diplomatic_balance(sys::state& state, dcon::nation_id n);
+float estimate_diplomatic_income(sys::state& state, dcon::nation_id n);
+float estimate_diplomatic_expenses(sys::state& state, dcon::nation_id n);
+float estimate_domestic_investment(sys::state& state, dcon::nation_id n);
+float estimate_land_spending(sys::state& state, dcon::nation_id n);
+float estimate_naval_spending(sys::state& state, dcon::nation_id n);
+float estimate_construction_spending(sys::state& state, dcon::nation_id n);
+float estimate_private_construction_spendings(sys::state& state, dcon::nation_id n);
+float estimate_war_subsidies_spending(sys::state& state, dcon::nation_id n);
+float estimate_reparations_spending(sys::state& state, dcon::nation_id n);
+float estimate_war_subsidies_income(sys::state& state, dcon::nation_id n);
+float estimate_reparations_income(sys::state& state, dcon::nation_id n);
+float estimate_overseas_penalty_spending(sys::state& state, dcon::nation_id n);
+float estimate_stockpile_filling_spending(sys::state& state, dcon::nation_id n);
+float estimate_subject_payments_paid(sys::state& state, dcon::nation_id n);
+float estimate_subject_payments_received(sys::state& state, dcon::nation_id n);
+float estimate_daily_income(sys::state& state, dcon::nation_id n);
+} // namespace cached
+
 struct construction_status {
 	float progress = 0.0f; // in range [0,1)
 	bool is_under_construction = false;
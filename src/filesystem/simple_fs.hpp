@@ -63,6 +63,8 @@ native_string get_full_name(directory const& f);
 // write_file will clear an existing file, if it exists, will create a new file if it does not
 void write_file(directory const& dir, native_string_view file_name, char const* file_data, uint32_t file_size);
 void append_file(directory const& dir, native_string_view file_name, char const* file_data, uint32_t file_size);
+// replaces new_name, if it exists, in a single step; returns false if the file could not be renamed
+bool rename_file(directory const& dir, native_string_view old_name, native_string_view new_name);
 
 
 // unopened file functions
@@ -81,6 +83,7 @@ directory get_or_create_oos_directory();
 directory get_or_create_scenario_directory();
 directory get_or_create_settings_directory();
 directory get_or_create_data_dumps_directory();
+directory get_or_create_jit_cache_directory();
 directory get_or_create_root_documents();
 
 // necessary for reading paths out of data from inside older paradox files:
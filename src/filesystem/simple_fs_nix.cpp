@@ -1,5 +1,6 @@
 #include <dirent.h>
 #include <fcntl.h>
+#include <stdio.h>
 #include <sys/mman.h>
 #include <sys/stat.h>
 #include <unistd.h>
@@ -460,6 +461,15 @@ void append_file(directory const& dir, native_string_view file_name, char const*
 	}
 }
 
+bool rename_file(directory const& dir, native_string_view old_name, native_string_view new_name) {
+	if(dir.parent_system)
+		std::abort();
+
+	native_string old_path = dir.relative_path + NATIVE('/') + native_string(old_name);
+	native_string new_path = dir.relative_path + NATIVE('/') + native_string(new_name);
+	return ::rename(old_path.c_str(), new_path.c_str()) == 0;
+}
+
 file_contents view_contents(file const& f) {
 	return f.content;
 }
@@ -522,6 +532,13 @@ directory get_or_create_data_dumps_directory() {
 	return directory(nullptr, path);
 }
 
+directory get_or_create_jit_cache_directory() {
+	native_string path = native_string(getenv("HOME")) + "/.local/share/Alice/jit_cache/";
+	make_directories(path);
+
+	return directory(nullptr, path);
+}
+
 directory get_or_create_scenario_directory() {
 	native_string path = native_string(getenv("HOME")) + "/.local/share/Alice/scenarios/";
 	make_directories(path);
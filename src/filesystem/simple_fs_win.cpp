@@ -379,6 +379,15 @@ void append_file(directory const& dir, native_string_view file_name, char const*
 	}
 }
 
+bool rename_file(directory const& dir, native_string_view old_name, native_string_view new_name) {
+	if(dir.parent_system)
+		std::abort();
+
+	native_string old_path = dir.relative_path + NATIVE('\\') + native_string(old_name);
+	native_string new_path = dir.relative_path + NATIVE('\\') + native_string(new_name);
+	return MoveFileExW(old_path.c_str(), new_path.c_str(), MOVEFILE_REPLACE_EXISTING) != 0;
+}
+
 file_contents view_contents(file const& f) {
 	return f.content;
 }
@@ -484,6 +493,21 @@ directory get_or_create_data_dumps_directory() {
 	return directory(nullptr, base_path);
 }
 
+directory get_or_create_jit_cache_directory() {
+	native_char* local_path_out = nullptr;
+	native_string base_path;
+	if(SHGetKnownFolderPath(FOLDERID_Documents, 0, nullptr, &local_path_out) == S_OK) {
+		base_path = native_string(local_path_out) + NATIVE("\\Project Alice");
+	}
+	CoTaskMemFree(local_path_out);
+	if(base_path.length() > 0) {
+		CreateDirectoryW(base_path.c_str(), nullptr);
+		base_path += NATIVE("\\jit_cache");
+		CreateDirectoryW(base_path.c_str(), nullptr);
+	}
+	return directory(nullptr, base_path);
+}
+
 native_string win1250_to_native(std::string_view data_in) {
 	native_string result;
 	for(auto ch : data_in) {
@@ -927,6 +927,7 @@ void execute_make_vassal(sys::state& state, dcon::nation_id source, dcon::nation
 		flags = uint8_t((flags & ~nations::influence::level_mask) | nations::influence::level_in_sphere);
 		state.world.nation_set_in_sphere_of(holder, source);
 	}
+	province::invalidate_path_cache(state, source);
 	nations::remove_cores_from_owned(state, holder, state.world.nation_get_identity_from_identity_holder(source));
 	auto& inf = state.world.nation_get_infamy(source);
 	inf = std::max(0.0f, inf + state.defines.release_nation_infamy);
@@ -1489,6 +1490,7 @@ void execute_add_to_sphere(sys::state& state, dcon::nation_id source, dcon::nati
 	l = nations::influence::increase_level(l);
 
 	state.world.nation_set_in_sphere_of(influence_target, source);
+	province::invalidate_path_cache(state, source);
 
 	notification::post(state, notification::message{
 		[source, influence_target](sys::state& state, text::layout_base& contents) {
@@ -1552,6 +1554,7 @@ void execute_remove_from_sphere(sys::state& state, dcon::nation_id source, dcon:
 	auto rel = state.world.get_gp_relationship_by_gp_influence_pair(influence_target, source);
 
 	state.world.nation_set_in_sphere_of(influence_target, dcon::nation_id{});
+	province::invalidate_path_cache(state, affected_gp);
 
 	auto orel = state.world.get_gp_relationship_by_gp_influence_pair(influence_target, affected_gp);
 	auto& l = state.world.gp_relationship_get_status(orel);
@@ -2383,6 +2386,7 @@ void execute_give_military_access(sys::state& state, dcon::nation_id asker, dcon
 		urel = state.world.force_create_unilateral_relationship(asker, target);
 	}
 	state.world.unilateral_relationship_set_military_access(urel, true);
+	province::invalidate_path_cache(state, target);
 	nations::adjust_relationship(state, asker, target, state.defines.givemilaccess_relation_on_accept);
 }
 
@@ -2614,6 +2618,7 @@ void execute_cancel_military_access(sys::state& state, dcon::nation_id source, d
 	auto rel = state.world.get_unilateral_relationship_by_unilateral_pair(target, source);
 	if(rel)
 		state.world.unilateral_relationship_set_military_access(rel, false);
+	province::invalidate_path_cache(state, source);
 
 	state.world.nation_get_diplomatic_points(source) -= state.defines.cancelaskmilaccess_diplomatic_cost;
 	nations::adjust_relationship(state, source, target, state.defines.cancelaskmilaccess_relation_on_accept);
@@ -2651,6 +2656,7 @@ void execute_cancel_given_military_access(sys::state& state, dcon::nation_id sou
 	auto rel = state.world.get_unilateral_relationship_by_unilateral_pair(source, target);
 	if(rel)
 		state.world.unilateral_relationship_set_military_access(rel, false);
+	province::invalidate_path_cache(state, target);
 
 	state.world.nation_get_diplomatic_points(source) -= state.defines.cancelgivemilaccess_diplomatic_cost;
 	nations::adjust_relationship(state, source, target, state.defines.cancelgivemilaccess_relation_on_accept);
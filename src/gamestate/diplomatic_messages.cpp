@@ -289,6 +289,7 @@ void accept(sys::state& state, message const& m) {
 			rel = state.world.force_create_unilateral_relationship(m.to, m.from);
 		}
 		state.world.unilateral_relationship_set_military_access(rel, true);
+		province::invalidate_path_cache(state, m.from);
 
 		notification::post(state, notification::message{
 			[source = m.from, target = m.to](sys::state& state, text::layout_base& contents) {
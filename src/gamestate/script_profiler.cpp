@@ -0,0 +1,203 @@
+#include <algorithm>
+#include "script_profiler.hpp"
+#include "system_state.hpp"
+#include "simple_fs.hpp"
+
+namespace sys {
+
+void script_profiler::reset(sys::state& state) {
+	auto reset_counters = [](std::unique_ptr<script_profile_counters[]>& counters, size_t& count, size_t new_count) {
+		if(!counters || count != new_count) {
+			counters = std::make_unique<script_profile_counters[]>(new_count);
+			count = new_count;
+		} else {
+			for(size_t i = 0; i < count; ++i) {
+				counters[i].calls.store(0, std::memory_order_relaxed);
+				counters[i].lanes.store(0, std::memory_order_relaxed);
+				counters[i].nanoseconds.store(0, std::memory_order_relaxed);
+			}
+		}
+	};
+	reset_counters(triggers, trigger_count, state.trigger_data_indices.size());
+	reset_counters(value_modifiers, value_modifier_count, state.value_modifiers.size());
+	reset_counters(effects, effect_count, state.effect_data_indices.size());
+}
+
+void script_profiler::record(script_kind kind, int32_t key_index, int32_t lanes, int64_t nanoseconds) {
+	script_profile_counters* counters = nullptr;
+	size_t count = 0;
+	switch(kind) {
+	case script_kind::trigger:
+		counters = triggers.get();
+		count = trigger_count;
+		break;
+	case script_kind::value_modifier:
+		counters = value_modifiers.get();
+		count = value_modifier_count;
+		break;
+	case script_kind::effect:
+		counters = effects.get();
+		count = effect_count;
+		break;
+	}
+	if(!counters || key_index < 0 || size_t(key_index) >= count)
+		return;
+	counters[key_index].calls.fetch_add(1, std::memory_order_relaxed);
+	counters[key_index].lanes.fetch_add(lanes, std::memory_order_relaxed);
+	counters[key_index].nanoseconds.fetch_add(nanoseconds, std::memory_order_relaxed);
+}
+
+namespace {
+
+struct script_sources {
+	std::vector<std::string> triggers;
+	std::vector<std::string> value_modifiers;
+	std::vector<std::string> effects;
+
+	static void add(std::vector<std::string>& names, int32_t index, std::string const& description) {
+		if(index < 0 || size_t(index) >= names.size())
+			return;
+		if(!names[index].empty())
+			names[index] += "; ";
+		names[index] += description;
+	}
+	void add(dcon::trigger_key k, std::string const& description) {
+		if(k)
+			add(triggers, k.index(), description);
+	}
+	void add(dcon::value_modifier_key k, std::string const& description) {
+		if(k)
+			add(value_modifiers, k.index(), description);
+	}
+	void add(dcon::effect_key k, std::string const& description) {
+		if(k)
+			add(effects, k.index(), description);
+	}
+};
+
+template<typename T>
+void add_event_sources(script_sources& sources, T event, std::string const& name) {
+	sources.add(event.get_immediate_effect(), name + " immediate");
+	auto const& options = event.get_options();
+	for(uint32_t i = 0; i < options.size(); ++i) {
+		sources.add(options[i].effect, name + " option " + std::to_string(i + 1));
+		sources.add(options[i].ai_chance, name + " option " + std::to_string(i + 1) + " ai_chance");
+	}
+}
+
+script_sources find_script_sources(sys::state& state) {
+	script_sources sources;
+	sources.triggers.resize(state.trigger_data_indices.size());
+	sources.value_modifiers.resize(state.value_modifiers.size());
+	sources.effects.resize(state.effect_data_indices.size());
+
+	for(auto e : state.world.in_free_national_event) {
+		auto name = "national event " + std::to_string(e.get_legacy_id());
+		sources.add(e.get_trigger(), name + " trigger");
+		sources.add(e.get_mtth(), name + " mean_time_to_happen");
+		add_event_sources(sources, e, name);
+	}
+	for(auto e : state.world.in_free_provincial_event) {
+		auto name = "province event " + std::to_string(e.get_legacy_id());
+		sources.add(e.get_trigger(), name + " trigger");
+		sources.add(e.get_mtth(), name + " mean_time_to_happen");
+		add_event_sources(sources, e, name);
+	}
+	for(auto e : state.world.in_national_event) {
+		add_event_sources(sources, e, "national event " + std::string(state.to_string_view(e.get_name())));
+	}
+	for(auto e : state.world.in_provincial_event) {
+		add_event_sources(sources, e, "province event " + std::string(state.to_string_view(e.get_name())));
+	}
+	for(auto d : state.world.in_decision) {
+		auto name = "decision " + std::string(state.to_string_view(d.get_name()));
+		sources.add(d.get_potential(), name + " potential");
+		sources.add(d.get_allow(), name + " allow");
+		sources.add(d.get_effect(), name + " effect");
+		sources.add(d.get_ai_will_do(), name + " ai_will_do");
+	}
+	for(auto s : state.world.in_stored_trigger) {
+		sources.add(s.get_function(), "scripted trigger " + std::string(state.to_string_view(s.get_name())));
+	}
+	for(auto p : state.world.in_pop_type) {
+		auto name = "pop type " + std::string(state.to_string_view(p.get_name()));
+		for(auto i : state.world.in_issue_option) {
+			sources.add(p.get_issues(i), name + " issue " + std::string(state.to_string_view(i.get_name())));
+		}
+		for(auto i : state.world.in_ideology) {
+			sources.add(p.get_ideology(i), name + " ideology " + std::string(state.to_string_view(i.get_name())));
+		}
+		for(auto t : state.world.in_pop_type) {
+			sources.add(p.get_promotion(t), name + " promote to " + std::string(state.to_string_view(t.get_name())));
+		}
+		sources.add(p.get_migration_target(), name + " migration_target");
+		sources.add(p.get_country_migration_target(), name + " country_migration_target");
+	}
+	sources.add(state.culture_definitions.promotion_chance, "promotion_chance");
+	sources.add(state.culture_definitions.demotion_chance, "demotion_chance");
+
+	// the conditions of a value modifier are described by the modifier they belong to
+	for(uint32_t i = 0; i < state.value_modifiers.size(); ++i) {
+		dcon::value_modifier_key k{ dcon::value_modifier_key::value_base_t(i) };
+		if(sources.value_modifiers[i].empty())
+			continue;
+		auto base = state.value_modifiers[k];
+		for(uint32_t j = 0; j < base.segments_count; ++j) {
+			auto seg = state.value_modifier_segments[base.first_segment_offset + j];
+			sources.add(seg.condition, "modifier of " + sources.value_modifiers[i]);
+		}
+	}
+	return sources;
+}
+
+} // namespace
+
+std::vector<script_profile_summary> script_profiler::summarize(sys::state& state) {
+	std::vector<script_profile_summary> result;
+	auto sources = find_script_sources(state);
+
+	auto collect = [&](script_kind kind, script_profile_counters const* counters, size_t count, std::vector<std::string> const& names) {
+		if(!counters)
+			return;
+		for(size_t i = 0; i < count; ++i) {
+			auto calls = counters[i].calls.load(std::memory_order_relaxed);
+			if(calls == 0)
+				continue;
+			script_profile_summary s;
+			s.kind = kind;
+			s.key_index = int32_t(i);
+			s.calls = calls;
+			s.lanes = counters[i].lanes.load(std::memory_order_relaxed);
+			s.nanoseconds = counters[i].nanoseconds.load(std::memory_order_relaxed);
+			s.source = i < names.size() && !names[i].empty() ? names[i] : std::string("unknown");
+			result.push_back(std::move(s));
+		}
+	};
+	collect(script_kind::trigger, triggers.get(), trigger_count, sources.triggers);
+	collect(script_kind::value_modifier, value_modifiers.get(), value_modifier_count, sources.value_modifiers);
+	collect(script_kind::effect, effects.get(), effect_count, sources.effects);
+
+	std::sort(result.begin(), result.end(), [](script_profile_summary const& a, script_profile_summary const& b) {
+		if(a.nanoseconds != b.nanoseconds)
+			return a.nanoseconds > b.nanoseconds;
+		if(a.kind != b.kind)
+			return a.kind < b.kind;
+		return a.key_index < b.key_index;
+	});
+	return result;
+}
+
+void script_profiler::write_csv(sys::state& state) {
+	std::string out = "kind,key,calls,lanes,total_us,source\n";
+	for(auto& s : summarize(state)) {
+		auto kind = s.kind == script_kind::trigger ? "trigger" : (s.kind == script_kind::value_modifier ? "value_modifier" : "effect");
+		auto source = s.source;
+		std::replace(source.begin(), source.end(), ',', ' ');
+		out += std::string(kind) + "," + std::to_string(s.key_index) + "," + std::to_string(s.calls) + "," + std::to_string(s.lanes) + ","
+			+ std::to_string(s.nanoseconds / 1000) + "," + source + "\n";
+	}
+	auto data_dumps_directory = simple_fs::get_or_create_data_dumps_directory();
+	simple_fs::write_file(data_dumps_directory, NATIVE("script_profile.csv"), out.c_str(), uint32_t(out.size()));
+}
+
+} // namespace sys
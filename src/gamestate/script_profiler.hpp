@@ -0,0 +1,83 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <string>
+#include <vector>
+#include "dcon_generated.hpp"
+
+namespace sys {
+struct state;
+
+//
+// Optional profiling of the trigger interpreter and of effects. When enabled, every call to trigger::evaluate,
+// trigger::evaluate_multiplicative_modifier / evaluate_additive_modifier and effect::execute made with a key counts the call, the
+// number of vector lanes it was made for and its wall time against that key; the conditions of a value modifier are counted as
+// triggers of their own. Times are inclusive: a trigger evaluated inside an
+// effect is counted for both. The report maps every key back to the scripts that use it
+//
+
+enum class script_kind : uint8_t { trigger, value_modifier, effect };
+
+struct script_profile_counters {
+	std::atomic<int64_t> calls = 0;
+	std::atomic<int64_t> lanes = 0;
+	std::atomic<int64_t> nanoseconds = 0;
+};
+
+struct script_profile_summary {
+	script_kind kind = script_kind::trigger;
+	int32_t key_index = 0;
+	int64_t calls = 0;
+	int64_t lanes = 0;
+	int64_t nanoseconds = 0;
+	std::string source;
+};
+
+struct script_profiler {
+	std::atomic<bool> enabled = false;
+
+	// the counters are allocated the first time the profiler is reset for a scenario and are kept afterwards, since other threads
+	// may still be recording into them right after the profiler has been disabled
+	std::unique_ptr<script_profile_counters[]> triggers;
+	std::unique_ptr<script_profile_counters[]> value_modifiers;
+	std::unique_ptr<script_profile_counters[]> effects;
+	size_t trigger_count = 0;
+	size_t value_modifier_count = 0;
+	size_t effect_count = 0;
+
+	void reset(sys::state& state);
+	void record(script_kind kind, int32_t key_index, int32_t lanes, int64_t nanoseconds);
+
+	// every key that was called at least once, from the most to the least expensive
+	std::vector<script_profile_summary> summarize(sys::state& state);
+	// writes the whole summary to script_profile.csv in the data dumps directory
+	void write_csv(sys::state& state);
+};
+
+struct script_profile_scope {
+	script_profiler& profiler;
+	std::chrono::time_point<std::chrono::steady_clock> start;
+	int32_t key_index = 0;
+	int32_t lanes = 0;
+	script_kind kind = script_kind::trigger;
+	bool active = false;
+
+	script_profile_scope(script_profiler& profiler, script_kind kind, int32_t key_index, int32_t lanes) : profiler(profiler), key_index(key_index), lanes(lanes), kind(kind) {
+		if(profiler.enabled.load(std::memory_order_relaxed)) {
+			active = true;
+			start = std::chrono::steady_clock::now();
+		}
+	}
+	~script_profile_scope() {
+		if(active) {
+			auto duration = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count();
+			profiler.record(kind, key_index, lanes, int64_t(duration));
+		}
+	}
+	script_profile_scope(script_profile_scope const&) = delete;
+	script_profile_scope& operator=(script_profile_scope const&) = delete;
+};
+
+} // namespace sys
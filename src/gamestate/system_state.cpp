@@ -39,6 +39,7 @@
 #include "blake2.h"
 #include "fif_common.hpp"
 #include "gui_deserialize.hpp"
+#include "tick_scheduler.hpp"
 
 namespace ui {
 
@@ -471,6 +472,9 @@ void state::render() { // called to render the frame may (and should) delay retu
 		return;
 
 	auto game_state_was_updated = game_state_updated.exchange(false, std::memory_order::acq_rel);
+	if(game_state_was_updated) {
+		ui_estimates.invalidate();
+	}
 	if(game_state_was_updated && !current_scene.starting_scene && !ui_state.lazy_load_in_game) {
 		window::change_cursor(*this, window::cursor_type::busy);
 		ui::create_in_game_windows(*this);
@@ -3184,6 +3188,9 @@ void state::load_scenario_data(parsers::error_handler& err, sys::year_month_day
 		}
 	}
 
+	// every trigger has been parsed at this point
+	parsers::optimize_trigger_data(*this);
+
 	nations::update_revanchism(*this);
 	fill_unsaved_data(); // we need this to run triggers
 
@@ -3286,6 +3293,8 @@ void state::load_scenario_data(parsers::error_handler& err, sys::year_month_day
 
 void state::preload() {
 	adjacency_data_out_of_date = true;
+	province_definitions.connected_regions_valid = false;
+	province_definitions.pending_owner_changes.clear();
 	for(auto si : world.in_state_instance) {
 		si.set_naval_base_is_taken(false);
 		si.set_capital(dcon::province_id{});
@@ -3328,6 +3337,98 @@ void state::preload() {
 	}
 }
 
+#ifdef USE_LLVM
+//
+// Compiled modifiers are cached in the jit cache directory, one file per scenario checksum. The file starts with a key made of
+// the cache version, the target description and a hash of the generated fif source; the object code is only reused when the
+// whole key matches
+//
+
+// bump whenever the fif compiler or the layout of the cache file changes in a way that the generated source does not show
+constexpr uint32_t jit_cache_version = 2;
+
+static native_string jit_cache_file_name(sys::state& state) {
+	std::string name = "jit_";
+	for(uint32_t i = 0; i < sys::checksum_key::key_size; ++i) {
+		constexpr char digits[] = "0123456789abcdef";
+		name += digits[state.scenario_checksum.key[i] >> 4];
+		name += digits[state.scenario_checksum.key[i] & 0x0F];
+	}
+	name += ".bin";
+	return simple_fs::utf8_to_native(name);
+}
+
+static std::string jit_cache_key(fif::environment& env, std::vector<std::string> const& sources) {
+	std::string all_sources;
+	for(auto& src : sources)
+		all_sources += src;
+	sys::checksum_key hash;
+	blake2b(&hash, sizeof(hash), all_sources.data(), all_sources.size(), nullptr, 0);
+
+	std::string key = std::to_string(jit_cache_version) + ";" + fif::jit_target_description(env) + ";";
+	for(uint32_t i = 0; i < sys::checksum_key::key_size; ++i)
+		key += std::to_string(uint32_t(hash.key[i])) + ",";
+	return key;
+}
+
+static void reset_jit_environment(sys::state& state) {
+	state.jit_environment = std::make_unique<fif::environment>();
+	state.jit_environment->report_error = [&state](std::string_view s) {
+		state.console_command_error += std::string("?R ERROR: ") + std::string(s) + "?W\\n";
+		};
+	fif::common_fif_environment(state, *state.jit_environment);
+}
+
+static void load_or_compile_jit_code(sys::state& state, std::vector<std::string>& sources) {
+	auto key = jit_cache_key(*state.jit_environment, sources);
+	auto cache_dir = simple_fs::get_or_create_jit_cache_directory();
+	auto file_name = jit_cache_file_name(state);
+
+	bool cache_rejected = false;
+	if(auto f = simple_fs::open_file(cache_dir, file_name); f) {
+		auto contents = simple_fs::view_contents(*f);
+		uint32_t key_length = 0;
+		if(contents.file_size > sizeof(uint32_t)) {
+			std::memcpy(&key_length, contents.data, sizeof(uint32_t));
+			if(contents.file_size > sizeof(uint32_t) + key_length
+				&& std::string_view(contents.data + sizeof(uint32_t), key_length) == key) {
+				auto object_start = contents.data + sizeof(uint32_t) + key_length;
+				if(fif::perform_jit_from_object(*state.jit_environment, object_start, contents.file_size - sizeof(uint32_t) - key_length))
+					return;
+				cache_rejected = true;
+			}
+		}
+	}
+	if(cache_rejected) {
+		// the failed load has already consumed the module and the target machine, so the code is compiled again from scratch
+		reset_jit_environment(state);
+	}
+
+	auto& env = *state.jit_environment;
+	fif::interpreter_stack values{ };
+	for(auto& src : sources)
+		fif::run_fif_interpreter(env, src, values);
+
+	auto object = fif::compile_to_object(env);
+	if(object.empty()) {
+		fif::perform_jit(env);
+		return;
+	}
+
+	// written under a temporary name first, so that an interrupted write never leaves a truncated file behind the right key
+	std::vector<char> file_data(sizeof(uint32_t) + key.size() + object.size());
+	uint32_t key_length = uint32_t(key.size());
+	std::memcpy(file_data.data(), &key_length, sizeof(uint32_t));
+	std::memcpy(file_data.data() + sizeof(uint32_t), key.data(), key.size());
+	std::memcpy(file_data.data() + sizeof(uint32_t) + key.size(), object.data(), object.size());
+	auto temp_name = file_name + NATIVE(".tmp");
+	simple_fs::write_file(cache_dir, temp_name, file_data.data(), uint32_t(file_data.size()));
+	simple_fs::rename_file(cache_dir, temp_name, file_name);
+
+	fif::perform_jit_from_object(env, object.data(), object.size());
+}
+#endif
+
 void state::on_scenario_load() {
 	world.pop_type_resize_issues_fns(world.issue_option_size());
 	world.pop_type_resize_ideology_fns(world.ideology_size());
@@ -3344,17 +3445,11 @@ void state::on_scenario_load() {
 #ifdef USE_LLVM
 
 	std::thread dispatch{ [&]() {
-	jit_environment = std::make_unique<fif::environment>();
-
-	int32_t error_count = 0;
-	std::string error_list;
-	jit_environment->report_error = [&](std::string_view s) {
-		console_command_error += std::string("?R ERROR: ") + std::string(s) + "?W\\n";
-		};
-	fif::common_fif_environment(*this, *jit_environment);
+	reset_jit_environment(*this);
 
 
-	fif::interpreter_stack values{ };
+	// the fif source of every function is generated first, since it is also part of the key of the object code cache
+	std::vector<std::string> jit_sources;
 
 	//AllocConsole();
 	//freopen("CONOUT$", "w", stdout);
@@ -3367,11 +3462,11 @@ void state::on_scenario_load() {
 			if(mkey) {
 				std::string fn_str = ": " + base_name + "internal >pop_id dup " + fif_trigger::multiplicative_modifier(*this, mkey) + " drop drop r> ; ";
 				fn_str += ":export " + base_name + "ext" + " i32 " + base_name + "internal ; ";
-				fif::run_fif_interpreter(*jit_environment, fn_str, values);
+				jit_sources.push_back(std::move(fn_str));
 			} else {
 				std::string fn_str = ": " + base_name + "internal" + " drop 0.0 ; ";
 				fn_str += ":export " + base_name + "ext" + " i32 " + base_name + "internal ; ";
-				fif::run_fif_interpreter(*jit_environment, fn_str, values);
+				jit_sources.push_back(std::move(fn_str));
 			}
 		}
 
@@ -3381,11 +3476,11 @@ void state::on_scenario_load() {
 			if(mkey) {
 				std::string fn_str = ": " + base_name + "internal >pop_id dup " + fif_trigger::multiplicative_modifier(*this, mkey) + " drop drop r> ; ";
 				fn_str += ":export " + base_name + "ext" + " i32 " + base_name + "internal ; ";
-				fif::run_fif_interpreter(*jit_environment, fn_str, values);
+				jit_sources.push_back(std::move(fn_str));
 			} else {
 				std::string fn_str = ": " + base_name + "internal" + " drop 0.0 ; ";
 				fn_str += ":export " + base_name + "ext" + " i32 " + base_name + "internal ; ";
-				fif::run_fif_interpreter(*jit_environment, fn_str, values);
+				jit_sources.push_back(std::move(fn_str));
 			}
 		}
 
@@ -3395,7 +3490,7 @@ void state::on_scenario_load() {
 			if(mkey) {
 				std::string fn_str = ": " + base_name + "internal >pop_id dup " + fif_trigger::additive_modifier(*this, mkey) + " drop drop r> ; ";
 				fn_str += ":export " + base_name + "ext" + " i32 " + base_name + "internal ; ";
-				fif::run_fif_interpreter(*jit_environment, fn_str, values);
+				jit_sources.push_back(std::move(fn_str));
 			}
 		}
 
@@ -3405,7 +3500,7 @@ void state::on_scenario_load() {
 			if(mkey) {
 				std::string fn_str = ": " + base_name + "internal swap >pop_id swap >province_id " + fif_trigger::multiplicative_modifier(*this, mkey) + " drop drop r> ; ";
 				fn_str += ":export " + base_name + "ext" + " i32 i32 " + base_name + "internal ; ";
-				fif::run_fif_interpreter(*jit_environment, fn_str, values);
+				jit_sources.push_back(std::move(fn_str));
 			}
 		}
 		{
@@ -3414,22 +3509,50 @@ void state::on_scenario_load() {
 			if(mkey) {
 				std::string fn_str = ": " + base_name + "internal swap >pop_id swap >nation_id " + fif_trigger::multiplicative_modifier(*this, mkey) + " drop drop r> ; ";
 				fn_str += ":export " + base_name + "ext" + " i32 i32 " + base_name + "internal ; ";
-				fif::run_fif_interpreter(*jit_environment, fn_str, values);
+				jit_sources.push_back(std::move(fn_str));
 			}
 		}
 	}
 	{
 		std::string fn_str = ": promote_internal >pop_id dup " + fif_trigger::additive_modifier(*this, culture_definitions.promotion_chance) + " drop drop r> ; ";
 		fn_str += ":export promote_ext i32 promote_internal ; ";
-		fif::run_fif_interpreter(*jit_environment, fn_str, values);
+		jit_sources.push_back(std::move(fn_str));
 	}
 	{
 		std::string fn_str = ": demote_internal >pop_id dup " + fif_trigger::additive_modifier(*this, culture_definitions.demotion_chance) + " drop drop r> ; ";
 		fn_str += ":export demote_ext i32 demote_internal ; ";
-		fif::run_fif_interpreter(*jit_environment, fn_str, values);
+		jit_sources.push_back(std::move(fn_str));
 	}
 
-	fif::perform_jit(*jit_environment);
+	// free events: the trigger returns 1.0 or 0.0 so that every exported function has the same signature
+	for(auto e : world.in_free_national_event) {
+		std::string base_name = "fne" + std::to_string(e.id.index());
+		if(auto t = e.get_trigger(); t) {
+			std::string fn_str = ": " + base_name + "tinternal >nation_id dup " + fif_trigger::evaluate(*this, t) + " swap drop swap drop >r 0.0 1.0 r> select ; ";
+			fn_str += ":export " + base_name + "text" + " i32 " + base_name + "tinternal ; ";
+			jit_sources.push_back(std::move(fn_str));
+		}
+		if(auto mkey = e.get_mtth(); mkey) {
+			std::string fn_str = ": " + base_name + "minternal >nation_id dup " + fif_trigger::multiplicative_modifier(*this, mkey) + " drop drop r> ; ";
+			fn_str += ":export " + base_name + "mext" + " i32 " + base_name + "minternal ; ";
+			jit_sources.push_back(std::move(fn_str));
+		}
+	}
+	for(auto e : world.in_free_provincial_event) {
+		std::string base_name = "fpe" + std::to_string(e.id.index());
+		if(auto t = e.get_trigger(); t) {
+			std::string fn_str = ": " + base_name + "tinternal >province_id dup " + fif_trigger::evaluate(*this, t) + " swap drop swap drop >r 0.0 1.0 r> select ; ";
+			fn_str += ":export " + base_name + "text" + " i32 " + base_name + "tinternal ; ";
+			jit_sources.push_back(std::move(fn_str));
+		}
+		if(auto mkey = e.get_mtth(); mkey) {
+			std::string fn_str = ": " + base_name + "minternal >province_id dup " + fif_trigger::multiplicative_modifier(*this, mkey) + " drop drop r> ; ";
+			fn_str += ":export " + base_name + "mext" + " i32 " + base_name + "minternal ; ";
+			jit_sources.push_back(std::move(fn_str));
+		}
+	}
+
+	load_or_compile_jit_code(*this, jit_sources);
 
 	//
 	// load exported fns
@@ -3627,6 +3750,39 @@ void state::on_scenario_load() {
 	//
 	// END set global values
 	//
+
+	//
+	// load event fns: these are only published once the global values above are set, since update_events may pick them up
+	// as soon as they are stored
+	//
+	auto lookup_export = [&](std::string const& name) {
+		LLVMOrcExecutorAddress bare_address = 0;
+		auto error = LLVMOrcLLJITLookup(jit_environment->llvm_jit, &bare_address, name.c_str());
+		if(error) {
+			auto msg = LLVMGetErrorMessage(error);
+#ifdef _WIN32
+			OutputDebugStringA(msg);
+			OutputDebugStringA("\n");
+#endif
+			LLVMDisposeErrorMessage(msg);
+			return uint64_t(0);
+		}
+		return uint64_t(bare_address);
+	};
+	for(auto e : world.in_free_national_event) {
+		std::string base_name = "fne" + std::to_string(e.id.index());
+		if(e.get_trigger())
+			e.set_trigger_fn(lookup_export(base_name + "text"));
+		if(e.get_mtth())
+			e.set_mtth_fn(lookup_export(base_name + "mext"));
+	}
+	for(auto e : world.in_free_provincial_event) {
+		std::string base_name = "fpe" + std::to_string(e.id.index());
+		if(e.get_trigger())
+			e.set_trigger_fn(lookup_export(base_name + "text"));
+		if(e.get_mtth())
+			e.set_mtth_fn(lookup_export(base_name + "mext"));
+	}
 	} };
 
 	dispatch.detach();
@@ -3704,6 +3860,10 @@ void state::fill_unsaved_data() { // reconstructs derived values that are not di
 		world.issue_set_issue_type(i, uint8_t(culture::issue_type::political));
 	}
 
+	// in multiplayer the host checksums the save before reloading it, so the layout must not change here
+	if(defines.alice_compact_pops > 0.0f && network_mode == sys::network_mode_type::single_player)
+		demographics::compact_pops(*this);
+
 	military::reset_unit_stats(*this);
 	culture::clear_existing_tech_effects(*this);
 	culture::repopulate_technology_effects(*this);
@@ -3711,7 +3871,10 @@ void state::fill_unsaved_data() { // reconstructs derived values that are not di
 	military::apply_base_unit_stat_modifiers(*this);
 
 	province::update_connected_regions(*this);
+	province::build_region_graph(*this);
+	province::invalidate_path_cache(*this);
 	province::restore_unsaved_values(*this);
+	event::build_event_trigger_guards(*this);
 
 	culture::update_all_nations_issue_rules(*this);
 	culture::restore_unsaved_values(*this);
@@ -3872,6 +4035,19 @@ void state::fill_unsaved_data() { // reconstructs derived values that are not di
 	game_state_updated.store(true, std::memory_order::release);
 }
 
+// names under which the once per month update of each day of the month is profiled
+static constexpr std::string_view monthly_tick_phase_names[32] = {
+	"monthly_none",
+	"monthly_01_update_monthly_points", "monthly_02_update_blockaded_cache", "monthly_03_monthly_leaders_update", "monthly_04_reinforce_regiments",
+	"monthly_05_update_rebel_movements", "monthly_06_form_alliances", "monthly_07_update_ai_general_status", "monthly_08_apply_attrition",
+	"monthly_09_repair_ships", "monthly_10_update_crimes", "monthly_11_update_nationalism", "monthly_12_update_ai_research",
+	"monthly_13_perform_influence_actions", "monthly_14_update_focuses", "monthly_15_discover_inventions", "monthly_16_build_ships",
+	"monthly_17_update_land_constructions", "monthly_18_update_ai_econ_construction", "monthly_19_update_budget", "monthly_20_monthly_flashpoint_update",
+	"monthly_21_update_ai_colony_starting", "monthly_22_take_reforms", "monthly_23_civilize_and_war_decs", "monthly_24_execute_rebel_victories",
+	"monthly_25_execute_province_defections", "monthly_26_make_peace_offers", "monthly_27_update_crisis_leaders", "monthly_28_rebel_risings_check",
+	"monthly_29_update_war_intervention", "monthly_30_update_ships", "monthly_31_update_cb_fabrication"
+};
+
 void state::single_game_tick() {
 	// do update logic
 
@@ -3883,9 +4059,14 @@ void state::single_game_tick() {
 		return;
 	}
 
+	tick_profile.begin_day(current_date);
+
 	auto ymd_date = current_date.to_ymd(start_date);
 
-	diplomatic_message::update_pending(*this);
+	{
+		sys::tick_phase_scope phase{ tick_profile, "diplomatic_messages" };
+		diplomatic_message::update_pending(*this);
+	}
 
 	auto month_start = sys::year_month_day{ ymd_date.year, ymd_date.month, uint16_t(1) };
 	auto next_month_start = ymd_date.month != 12 ? sys::year_month_day{ ymd_date.year, uint16_t(ymd_date.month + 1), uint16_t(1) } : sys::year_month_day{ ymd_date.year + 1, uint16_t(1), uint16_t(1) };
@@ -3899,6 +4080,9 @@ void state::single_game_tick() {
 	static demographics::migration_buffer mbuf;
 	static demographics::migration_buffer cmbuf;
 	static demographics::migration_buffer imbuf;
+	static std::array<demographics::pop_transfer_buffer, 5> tbufs;
+
+	sys::tick_phase_scope demographics_phase{ tick_profile, "demographics" };
 
 	// calculate complex changes in parallel where we can, but don't actually apply the results
 	// instead, the changes are saved to be applied only after all triggers have been evaluated
@@ -3906,6 +4090,7 @@ void state::single_game_tick() {
 		switch(index) {
 		case 0:
 		{
+			sys::tick_phase_scope phase{ tick_profile, "demographics_update_ideologies", sys::tick_phase_kind::nested };
 			auto o = uint32_t(ymd_date.day);
 			if(o >= days_in_month)
 				o -= days_in_month;
@@ -3914,6 +4099,7 @@ void state::single_game_tick() {
 		}
 		case 1:
 		{
+			sys::tick_phase_scope phase{ tick_profile, "demographics_update_issues", sys::tick_phase_kind::nested };
 			auto o = uint32_t(ymd_date.day + 1);
 			if(o >= days_in_month)
 				o -= days_in_month;
@@ -3922,6 +4108,7 @@ void state::single_game_tick() {
 		}
 		case 2:
 		{
+			sys::tick_phase_scope phase{ tick_profile, "demographics_update_type_changes", sys::tick_phase_kind::nested };
 			auto o = uint32_t(ymd_date.day + 6);
 			if(o >= days_in_month)
 				o -= days_in_month;
@@ -3930,6 +4117,7 @@ void state::single_game_tick() {
 		}
 		case 3:
 		{
+			sys::tick_phase_scope phase{ tick_profile, "demographics_update_assimilation", sys::tick_phase_kind::nested };
 			auto o = uint32_t(ymd_date.day + 7);
 			if(o >= days_in_month)
 				o -= days_in_month;
@@ -3938,6 +4126,7 @@ void state::single_game_tick() {
 		}
 		case 4:
 		{
+			sys::tick_phase_scope phase{ tick_profile, "demographics_update_internal_migration", sys::tick_phase_kind::nested };
 			auto o = uint32_t(ymd_date.day + 8);
 			if(o >= days_in_month)
 				o -= days_in_month;
@@ -3946,6 +4135,7 @@ void state::single_game_tick() {
 		}
 		case 5:
 		{
+			sys::tick_phase_scope phase{ tick_profile, "demographics_update_colonial_migration", sys::tick_phase_kind::nested };
 			auto o = uint32_t(ymd_date.day + 9);
 			if(o >= days_in_month)
 				o -= days_in_month;
@@ -3954,6 +4144,7 @@ void state::single_game_tick() {
 		}
 		case 6:
 		{
+			sys::tick_phase_scope phase{ tick_profile, "demographics_update_immigration", sys::tick_phase_kind::nested };
 			auto o = uint32_t(ymd_date.day + 10);
 			if(o >= days_in_month)
 				o -= days_in_month;
@@ -3970,6 +4161,7 @@ void state::single_game_tick() {
 		switch(index) {
 		case 0:
 		{
+			sys::tick_phase_scope phase{ tick_profile, "demographics_apply_ideologies", sys::tick_phase_kind::nested };
 			auto o = uint32_t(ymd_date.day + 0);
 			if(o >= days_in_month)
 				o -= days_in_month;
@@ -3978,6 +4170,7 @@ void state::single_game_tick() {
 		}
 		case 1:
 		{
+			sys::tick_phase_scope phase{ tick_profile, "demographics_apply_issues", sys::tick_phase_kind::nested };
 			auto o = uint32_t(ymd_date.day + 1);
 			if(o >= days_in_month)
 				o -= days_in_month;
@@ -3986,6 +4179,7 @@ void state::single_game_tick() {
 		}
 		case 2:
 		{
+			sys::tick_phase_scope phase{ tick_profile, "demographics_update_militancy", sys::tick_phase_kind::nested };
 			auto o = uint32_t(ymd_date.day + 2);
 			if(o >= days_in_month)
 				o -= days_in_month;
@@ -3994,6 +4188,7 @@ void state::single_game_tick() {
 		}
 		case 3:
 		{
+			sys::tick_phase_scope phase{ tick_profile, "demographics_update_consciousness", sys::tick_phase_kind::nested };
 			auto o = uint32_t(ymd_date.day + 3);
 			if(o >= days_in_month)
 				o -= days_in_month;
@@ -4002,6 +4197,7 @@ void state::single_game_tick() {
 		}
 		case 4:
 		{
+			sys::tick_phase_scope phase{ tick_profile, "demographics_update_literacy", sys::tick_phase_kind::nested };
 			auto o = uint32_t(ymd_date.day + 4);
 			if(o >= days_in_month)
 				o -= days_in_month;
@@ -4010,6 +4206,7 @@ void state::single_game_tick() {
 		}
 		case 5:
 		{
+			sys::tick_phase_scope phase{ tick_profile, "demographics_update_growth", sys::tick_phase_kind::nested };
 			auto o = uint32_t(ymd_date.day + 5);
 			if(o >= days_in_month)
 				o -= days_in_month;
@@ -4017,380 +4214,551 @@ void state::single_game_tick() {
 			break;
 		}
 		case 6:
+		{
+			sys::tick_phase_scope phase{ tick_profile, "demographics_reset_net_migration", sys::tick_phase_kind::nested };
 			province::ve_for_each_land_province(*this,
 					[&](auto ids) { world.province_set_daily_net_migration(ids, ve::fp_vector{}); });
 			break;
+		}
 		case 7:
+		{
+			sys::tick_phase_scope phase{ tick_profile, "demographics_reset_net_immigration", sys::tick_phase_kind::nested };
 			province::ve_for_each_land_province(*this,
 					[&](auto ids) { world.province_set_daily_net_immigration(ids, ve::fp_vector{}); });
 			break;
+		}
 		default:
 			break;
 		}
 	});
 
-	// because they may add pops, these changes must be applied sequentially
-	{
-		auto o = uint32_t(ymd_date.day + 6);
-		if(o >= days_in_month)
-			o -= days_in_month;
-		demographics::apply_type_changes(*this, o, days_in_month, pbuf);
-	}
-	{
-		auto o = uint32_t(ymd_date.day + 7);
-		if(o >= days_in_month)
-			o -= days_in_month;
-		demographics::apply_assimilation(*this, o, days_in_month, abuf);
-	}
-	{
-		auto o = uint32_t(ymd_date.day + 8);
+	// these may add pops: each stage only queues its transfers, and the new pops are then created in stage order so that
+	// they get the same ids on every client
+	concurrency::parallel_for(0, 5, [&](int32_t index) {
+		auto o = uint32_t(ymd_date.day + 6 + index);
 		if(o >= days_in_month)
 			o -= days_in_month;
-		demographics::apply_internal_migration(*this, o, days_in_month, mbuf);
-	}
+		switch(index) {
+		case 0:
+		{
+			sys::tick_phase_scope phase{ tick_profile, "demographics_apply_type_changes", sys::tick_phase_kind::nested };
+			demographics::apply_type_changes(*this, o, days_in_month, pbuf, tbufs[0]);
+			break;
+		}
+		case 1:
+		{
+			sys::tick_phase_scope phase{ tick_profile, "demographics_apply_assimilation", sys::tick_phase_kind::nested };
+			demographics::apply_assimilation(*this, o, days_in_month, abuf, tbufs[1]);
+			break;
+		}
+		case 2:
+		{
+			sys::tick_phase_scope phase{ tick_profile, "demographics_apply_internal_migration", sys::tick_phase_kind::nested };
+			demographics::apply_internal_migration(*this, o, days_in_month, mbuf, tbufs[2]);
+			break;
+		}
+		case 3:
+		{
+			sys::tick_phase_scope phase{ tick_profile, "demographics_apply_colonial_migration", sys::tick_phase_kind::nested };
+			demographics::apply_colonial_migration(*this, o, days_in_month, cmbuf, tbufs[3]);
+			break;
+		}
+		case 4:
+		{
+			sys::tick_phase_scope phase{ tick_profile, "demographics_apply_immigration", sys::tick_phase_kind::nested };
+			demographics::apply_immigration(*this, o, days_in_month, imbuf, tbufs[4]);
+			break;
+		}
+		default:
+			break;
+		}
+	});
 	{
-		auto o = uint32_t(ymd_date.day + 9);
-		if(o >= days_in_month)
-			o -= days_in_month;
-		demographics::apply_colonial_migration(*this, o, days_in_month, cmbuf);
+		sys::tick_phase_scope phase{ tick_profile, "demographics_merge_pop_transfers", sys::tick_phase_kind::nested };
+		for(auto& b : tbufs)
+			demographics::merge_pop_transfers(*this, b);
 	}
 	{
-		auto o = uint32_t(ymd_date.day + 10);
-		if(o >= days_in_month)
-			o -= days_in_month;
-		demographics::apply_immigration(*this, o, days_in_month, imbuf);
+		sys::tick_phase_scope phase{ tick_profile, "demographics_remove_size_zero_pops", sys::tick_phase_kind::nested };
+		demographics::remove_size_zero_pops(*this);
 	}
 
-	demographics::remove_size_zero_pops(*this);
-
 	// basic repopulation of demographics derived values
 
 	int64_t pc_difference = 0;
 
-	if(network_mode != network_mode_type::single_player)
+	if(network_mode != network_mode_type::single_player) {
+		sys::tick_phase_scope phase{ tick_profile, "demographics_regenerate_from_pop_data_daily", sys::tick_phase_kind::nested };
 		demographics::regenerate_from_pop_data_daily(*this);
+	}
+
+	demographics_phase.finish();
 
 	//
 	// ALTERNATE PAR DEMO START POINT A
 	//
 
-	concurrency::parallel_invoke([&]() {
-		// values updates pass 1 (mostly trivial things, can be done in parallel)
-		concurrency::parallel_for(0, 17, [&](int32_t index) {
-			switch(index) {
-			case 0:
-				ai::refresh_home_ports(*this);
-				break;
-			case 1:
-				// Instant research cheat
-				for(auto n : this->cheat_data.instant_research_nations) {
-					auto tech = this->world.nation_get_current_research(n);
-					if(tech.is_valid()) {
-						float points = culture::effective_technology_cost(*this, this->current_date.to_ymd(this->start_date).year, n, tech);
-						this->world.nation_set_research_points(n, points);
-					}
+	auto run_day = [&]() {
+		sys::tick_graph graph;
+
+		// groups of tables that many of the stages below read or write together
+		std::vector<std::string_view> const unit_tables{ "army", "navy", "regiment", "ship", "army_control", "army_rebel_control", "navy_control",
+			"army_location", "navy_location", "army_membership", "navy_membership", "army_leadership", "navy_leadership", "army_transport",
+			"regiment_source", "automation", "automated_army_group_membership_regiment", "automated_army_group_membership_navy" };
+		std::vector<std::string_view> const battle_tables{ "land_battle", "naval_battle", "army_battle_participation", "navy_battle_participation",
+			"attacking_general", "defending_general", "attacking_admiral", "defending_admiral", "land_battle_in_war", "land_battle_location",
+			"naval_battle_in_war", "naval_battle_location" };
+		std::vector<std::string_view> const leader_tables{ "leader", "leader_trait", "leader_loyalty" };
+		std::vector<std::string_view> const war_tables{ "war", "war_participant", "wargoal", "wargoals_attached", "war_settlement",
+			"pending_peace_offer", "peace_offer", "peace_offer_item" };
+		std::vector<std::string_view> const map_tables{ "province", "state_instance", "state_definition", "province_ownership", "province_control",
+			"province_rebel_control", "state_ownership", "abstract_state_membership", "region_membership", "core", "identity_holder",
+			"province_adjacency", "nation_adjacency" };
+		std::vector<std::string_view> const diplomacy_tables{ "diplomatic_relation", "unilateral_relationship", "gp_relationship", "overlord" };
+		std::vector<std::string_view> const pop_tables{ "pop", "pop_type", "pop_location", "pop_movement_membership", "pop_rebellion_membership" };
+		// everything that moving, fighting or ordering around units may look at
+		auto const military_reads = sys::tick_tables_join({ unit_tables, battle_tables, leader_tables, war_tables, map_tables, diplomacy_tables,
+			{ "nation", "rebel_faction", "rebellion_within" } });
+
+		// values updates pass 1 (mostly trivial things that only touch their own results)
+		graph.add("refresh_home_ports", [&](sys::state&) { ai::refresh_home_ports(*this); },
+			sys::tick_tables_join({ map_tables, { "nation.capital", "nation.is_player_controlled", "nation.owned_province_count" } }),
+			{ "nation.ai_home_port" });
+		graph.add("update_research_points", [&](sys::state&) {
+			// Instant research cheat
+			for(auto n : this->cheat_data.instant_research_nations) {
+				auto tech = this->world.nation_get_current_research(n);
+				if(tech.is_valid()) {
+					float points = culture::effective_technology_cost(*this, this->current_date.to_ymd(this->start_date).year, n, tech);
+					this->world.nation_set_research_points(n, points);
 				}
-				nations::update_research_points(*this);
-				break;
-			case 2:
-				military::regenerate_land_unit_average(*this);
-				break;
-			case 3:
-				military::regenerate_ship_scores(*this);
-				break;
-			case 4:
-				nations::update_industrial_scores(*this);
-				break;
-			case 5:
-				military::update_naval_supply_points(*this);
-				break;
-			case 6:
-				military::update_all_recruitable_regiments(*this);
-				break;
-			case 7:
-				military::regenerate_total_regiment_counts(*this);
-				break;
-			case 8:
-				economy::update_rgo_employment(*this);
-				break;
-			case 9:
-				economy::update_factory_employment(*this);
-				break;
-			case 10:
-				nations::update_administrative_efficiency(*this);
-				rebel::daily_update_rebel_organization(*this);
-				break;
-			case 11:
-				military::daily_leaders_update(*this);
-				break;
-			case 12:
-				politics::daily_party_loyalty_update(*this);
-				break;
-			case 13:
-				nations::daily_update_flashpoint_tension(*this);
-				break;
-			case 14:
-				military::update_ticking_war_score(*this);
-				break;
-			case 15:
-				military::increase_dig_in(*this);
-				break;
-			case 16:
-				military::update_blockade_status(*this);
-				break;
 			}
-		});
-
-		economy::daily_update(*this, false, 1.f);
+			nations::update_research_points(*this);
+		}, { "nation.current_research", "nation.demographics", "nation.factory_type_experience", "nation.factory_type_experience_priority_national",
+				"nation.factory_type_experience_priority_private", "nation.is_civilized", "nation.modifier_values", "nation.owned_province_count",
+				"nation.research_points", "nation.active_technologies", "technology", "pop_type", "factory_type" },
+			{ "nation.research_points", "nation.factory_type_experience" });
+		graph.add("regenerate_land_unit_average", [&](sys::state&) { military::regenerate_land_unit_average(*this); },
+			{ "nation.active_unit", "nation.modifier_values", "nation.unit_stats" },
+			{ "nation.averge_land_unit_score" });
+		graph.add("regenerate_ship_scores", [&](sys::state&) { military::regenerate_ship_scores(*this); },
+			{ "nation.active_unit", "nation.modifier_values", "nation.unit_stats", "navy", "navy_control", "navy_membership", "ship" },
+			{ "nation.capital_ship_score" });
+		graph.add("update_industrial_scores", [&](sys::state&) { nations::update_industrial_scores(*this); },
+			sys::tick_tables_join({ map_tables, { "nation.demographics", "nation.owned_province_count", "factory", "factory_location", "factory_type",
+				"unilateral_relationship" } }),
+			{ "nation.industrial_score" });
+		graph.add("update_naval_supply_points", [&](sys::state&) { military::update_naval_supply_points(*this); },
+			sys::tick_tables_join({ map_tables, { "nation.capital", "nation.modifier_values", "navy", "navy_control", "navy_membership", "ship" } }),
+			{ "nation.naval_supply_points", "nation.used_naval_supply_points" });
+		graph.add("update_all_recruitable_regiments", [&](sys::state&) { military::update_all_recruitable_regiments(*this); },
+			sys::tick_tables_join({ pop_tables, { "nation.recruitable_regiments", "province.is_colonial", "province.is_owner_core", "province_ownership",
+				"regiment_source" } }),
+			{ "nation.recruitable_regiments" });
+		graph.add("regenerate_total_regiment_counts", [&](sys::state&) { military::regenerate_total_regiment_counts(*this); },
+			{ "army", "army_control", "army_membership" },
+			{ "nation.active_regiments" });
+		graph.add("update_rgo_employment", [&](sys::state&) { economy::update_rgo_employment(*this); },
+			sys::tick_tables_join({ pop_tables, { "nation.capital", "nation.modifier_values", "nation.rgo_goods_output", "nation.rgo_size", "province",
+				"province_ownership", "abstract_state_membership", "state_ownership", "commodity", "market", "local_market", "culture", "ideology",
+				"issue_option" } }),
+			{ "pop.uemployment", "province.rgo_employment", "province.rgo_employment_per_good", "province.subsistence_employment" });
+		graph.add("update_factory_employment", [&](sys::state&) { economy::update_factory_employment(*this); },
+			sys::tick_tables_join({ pop_tables, { "factory", "factory_location", "factory_type", "province_ownership", "abstract_state_membership",
+				"state_instance", "state_ownership", "market", "local_market" } }),
+			{ "factory.primary_employment", "factory.secondary_employment", "pop.uemployment" });
+		graph.add("update_administrative_efficiency", [&](sys::state&) { nations::update_administrative_efficiency(*this); },
+			{ "nation.issues", "nation.modifier_values", "nation.non_colonial_bureaucrats", "nation.non_colonial_population", "issue_option" },
+			{ "nation.administrative_efficiency" });
+		graph.add("daily_update_rebel_organization", [&](sys::state&) { rebel::daily_update_rebel_organization(*this); },
+			sys::tick_tables_join({ pop_tables, { "nation.administrative_efficiency", "nation.rebel_org_modifier", "rebel_faction", "rebellion_within",
+				"regiment_source" } }),
+			{ "rebel_faction.organization", "rebel_faction.possible_regiments" });
+		graph.add("daily_leaders_update", [&](sys::state&) { military::daily_leaders_update(*this); },
+			sys::tick_tables_join({ leader_tables, battle_tables, { "nation", "army_leadership", "navy_leadership", "army_location", "navy_location" } }),
+			{ "leader", "leader_loyalty", "army_leadership", "navy_leadership", "attacking_general", "defending_general", "attacking_admiral",
+				"defending_admiral", sys::tick_tables::messages }); // dead leaders are removed from their armies and battles
+		graph.add("daily_party_loyalty_update", [&](sys::state&) { politics::daily_party_loyalty_update(*this); },
+			{ "province.party_loyalty", "abstract_state_membership", "state_instance.owner_focus", "national_focus" },
+			{ "province.party_loyalty" });
+		graph.add("daily_update_flashpoint_tension", [&](sys::state&) { nations::daily_update_flashpoint_tension(*this); },
+			{ "nation", "province", "state_instance", "state_ownership", "flashpoint_focus", "rebel_faction", "movement", "movement_within",
+				"pop_movement_membership", "national_identity", "culture", sys::tick_tables::globals },
+			{ "state_instance.flashpoint_tension" });
+		graph.add("increase_dig_in", [&](sys::state&) { military::increase_dig_in(*this); },
+			{ "army", "army_control", "army_location", "army_transport", "army_battle_participation", "navy", "nation.modifier_values",
+				"province.modifier_values" },
+			{ "army.dig_in" });
+		graph.add("update_blockade_status", [&](sys::state&) { military::update_blockade_status(*this); },
+			sys::tick_tables_join({ war_tables, { "navy", "navy_control", "navy_location", "navy_battle_participation", "army.is_retreating",
+				"province.port_to", "province_ownership", "province_control", "diplomatic_relation", "overlord" } }),
+			{ "province.is_blockaded" });
+		graph.add("update_ticking_war_score", [&](sys::state&) { military::update_ticking_war_score(*this); },
+			{ sys::tick_tables::everything }, // evaluates the wargoal triggers, so it waits for the rest of the pass
+			{ "wargoal.ticking_war_score" });
+
+		graph.add("economy_daily_update", [&](sys::state&) { economy::daily_update(*this, false, 1.f); },
+			{ sys::tick_tables::everything }, { sys::tick_tables::everything }); // bankruptcies fire events
 
 		//
 		// ALTERNATE PAR DEMO START POINT B
 		//
 
-		military::recover_org(*this);
-		military::update_siege_progress(*this);
-		military::update_movement(*this);
-		military::update_naval_battles(*this);
-		military::update_land_battles(*this);
-
-		military::advance_mobilizations(*this);
-
-		province::update_colonization(*this);
-		military::update_cbs(*this); // may add/remove cbs to a nation
-
-		event::update_events(*this);
-
-		culture::update_research(*this, uint32_t(ymd_date.year));
-
-		nations::update_military_scores(*this); // depends on ship score, land unit average
-		nations::update_rankings(*this);				// depends on industrial score, military scores
-		nations::update_great_powers(*this);		// depends on rankings
-		nations::update_influence(*this);				// depends on rankings, great powers
-
-		nations::update_crisis(*this);
-		politics::update_elections(*this);
+		graph.add("recover_org", [&](sys::state&) { military::recover_org(*this); },
+			sys::tick_tables_join({ unit_tables, battle_tables, leader_tables, { "province.modifier_values", "nation", "rebellion_within" } }),
+			{ "regiment.org", "ship.org" });
+		graph.add("update_siege_progress", [&](sys::state&) { military::update_siege_progress(*this); },
+			{ sys::tick_tables::everything }, { sys::tick_tables::everything }); // may fire on_siege_over events
+		graph.add("update_movement", [&](sys::state&) { military::update_movement(*this); },
+			military_reads,
+			sys::tick_tables_join({ unit_tables, battle_tables }));
+		graph.add("update_naval_battles", [&](sys::state&) { military::update_naval_battles(*this); },
+			sys::tick_tables_join({ military_reads, pop_tables }),
+			sys::tick_tables_join({ unit_tables, battle_tables, { "war", "nation.prestige", "leader.prestige", "pop.size", sys::tick_tables::messages } }));
+		graph.add("update_land_battles", [&](sys::state&) { military::update_land_battles(*this); },
+			sys::tick_tables_join({ military_reads, pop_tables }),
+			sys::tick_tables_join({ unit_tables, battle_tables, { "war", "nation.prestige", "leader.prestige", "pop.size", sys::tick_tables::messages } }));
+
+		graph.add("advance_mobilizations", [&](sys::state&) { military::advance_mobilizations(*this); },
+			sys::tick_tables_join({ military_reads, pop_tables, { "national_identity" } }),
+			sys::tick_tables_join({ unit_tables, battle_tables, { "nation.mobilization_remaining" } })); // new armies may start battles on arrival
+
+		graph.add("update_colonization", [&](sys::state&) { province::update_colonization(*this); },
+			{ sys::tick_tables::everything }, { sys::tick_tables::everything }); // ai colonies may change province owners
+		graph.add("update_cbs", [&](sys::state&) { military::update_cbs(*this); }, // may add/remove cbs to a nation
+			{ sys::tick_tables::everything }, // evaluates the cb triggers
+			{ "nation", "diplomatic_relation", "unilateral_relationship", "state_instance.flashpoint_tension", sys::tick_tables::messages });
+
+		graph.add("update_events", [&](sys::state&) { event::update_events(*this); },
+			{ sys::tick_tables::everything }, { sys::tick_tables::everything });
+
+		graph.add("update_research", [&](sys::state&) { culture::update_research(*this, uint32_t(ymd_date.year)); },
+			{ "nation", "technology", "invention", "modifier", "factory_type", "pop_type", "issue_option", "reform_option", "national_focus", "province",
+				"overlord" },
+			{ "nation", sys::tick_tables::messages }); // applies technologies and their modifiers
+
+		graph.add("update_military_scores", [&](sys::state&) { nations::update_military_scores(*this); }, // depends on ship score, land unit average
+			{ "nation.active_regiments", "nation.averge_land_unit_score", "nation.capital_ship_score", "nation.disarmed_until", "nation.modifier_values",
+				"nation.recruitable_regiments" },
+			{ "nation.military_score" });
+		graph.add("update_rankings", [&](sys::state&) { nations::update_rankings(*this); }, // depends on industrial score, military scores
+			{ "nation.industrial_score", "nation.is_civilized", "nation.military_score", "nation.modifier_values", "nation.owned_province_count",
+				"nation.prestige", "overlord", "rebellion_within", sys::tick_tables::globals },
+			{ "nation.rank", sys::tick_tables::globals });
+		graph.add("update_great_powers", [&](sys::state&) { nations::update_great_powers(*this); }, // depends on rankings
+			{ sys::tick_tables::everything }, { sys::tick_tables::everything }); // may fire on_lose_great_nation events
+		graph.add("update_influence", [&](sys::state&) { nations::update_influence(*this); }, // depends on rankings, great powers
+			{ "nation", "overlord", "province", "state_instance", "state_ownership", "gp_relationship", "unilateral_relationship", "diplomatic_relation",
+				"nation_adjacency", "war_participant", sys::tick_tables::globals },
+			{ "gp_relationship" });
+
+		graph.add("update_crisis", [&](sys::state&) { nations::update_crisis(*this); },
+			{ sys::tick_tables::everything }, { sys::tick_tables::everything });
+		graph.add("update_elections", [&](sys::state&) { politics::update_elections(*this); },
+			{ sys::tick_tables::everything }, { sys::tick_tables::everything });
 
 		if(current_date.value % 4 == 0) {
-			ai::update_ai_colonial_investment(*this);
+			graph.add("update_ai_colonial_investment", [&](sys::state&) { ai::update_ai_colonial_investment(*this); },
+				sys::tick_tables_join({ map_tables, { "nation", "colonization", "technology", "navy", "navy_control", "navy_membership", "ship",
+					"factory", "factory_location", sys::tick_tables::globals } }),
+				{ "colonization", "state_definition.colonization_stage" });
 		}
-
 		if(defines.alice_eval_ai_mil_everyday != 0.0f) {
-			ai::make_defense(*this);
-			ai::make_attacks(*this);
-			ai::update_ships(*this);
+			graph.add("ai_daily_military", [&](sys::state&) {
+				ai::make_defense(*this);
+				ai::make_attacks(*this);
+				ai::update_ships(*this);
+			}, military_reads, unit_tables);
 		}
-		ai::take_ai_decisions(*this);
+		graph.add("take_ai_decisions", [&](sys::state&) { ai::take_ai_decisions(*this); },
+			{ sys::tick_tables::everything }, { sys::tick_tables::everything });
 
 		// Once per month updates, spread out over the month
 		switch(ymd_date.day) {
 		case 1:
-			nations::update_monthly_points(*this);
-			economy::prune_factories(*this);
+			graph.add(monthly_tick_phase_names[1], [&](sys::state&) {
+				nations::update_monthly_points(*this);
+				economy::prune_factories(*this);
+			}, { sys::tick_tables::everything }, // evaluates cb triggers
+				{ "nation", "diplomatic_relation", "factory", "factory_location", "state_building_construction" });
 			break;
 		case 2:
-			province::update_blockaded_cache(*this);
-			sys::update_modifier_effects(*this);
+			graph.add(monthly_tick_phase_names[2], [&](sys::state&) {
+				province::update_blockaded_cache(*this);
+				sys::update_modifier_effects(*this);
+			}, { sys::tick_tables::everything }, // evaluates modifier triggers
+				{ "nation", "province" });
 			break;
 		case 3:
-			military::monthly_leaders_update(*this);
-			ai::add_gw_goals(*this);
+			graph.add(monthly_tick_phase_names[3], [&](sys::state&) {
+				military::monthly_leaders_update(*this);
+				ai::add_gw_goals(*this);
+			}, { sys::tick_tables::everything }, { sys::tick_tables::everything }); // adding wargoals runs their effects
 			break;
 		case 4:
-			military::reinforce_regiments(*this);
-			if(!bool(defines.alice_eval_ai_mil_everyday)) {
-				ai::make_defense(*this);
-			}
+			graph.add(monthly_tick_phase_names[4], [&](sys::state&) {
+				military::reinforce_regiments(*this);
+				if(!bool(defines.alice_eval_ai_mil_everyday)) {
+					ai::make_defense(*this);
+				}
+			}, sys::tick_tables_join({ military_reads, pop_tables }), { "regiment", "ship", "army" });
 			break;
 		case 5:
-			rebel::update_movements(*this);
-			rebel::update_factions(*this);
+			graph.add(monthly_tick_phase_names[5], [&](sys::state&) {
+				rebel::update_movements(*this);
+				rebel::update_factions(*this);
+			}, { sys::tick_tables::everything }, // evaluates movement and rebel triggers
+				{ "movement", "movement_within", "pop_movement_membership", "pop_rebellion_membership", "rebel_faction", "rebellion_within",
+					"province_control", "province_rebel_control", "army_rebel_control", "pop", "nation", "province", sys::tick_tables::messages });
 			break;
 		case 6:
-			ai::form_alliances(*this);
-			if(!bool(defines.alice_eval_ai_mil_everyday)) {
-				ai::make_attacks(*this);
-			}
+			graph.add(monthly_tick_phase_names[6], [&](sys::state&) {
+				ai::form_alliances(*this);
+				if(!bool(defines.alice_eval_ai_mil_everyday)) {
+					ai::make_attacks(*this);
+				}
+			}, military_reads, { "diplomatic_relation", "nation", "army", "navy", sys::tick_tables::messages });
 			break;
 		case 7:
-			ai::update_ai_general_status(*this);
+			graph.add(monthly_tick_phase_names[7], [&](sys::state&) { ai::update_ai_general_status(*this); },
+				sys::tick_tables_join({ diplomacy_tables, war_tables, { "nation", "nation_adjacency", "rebellion_within" } }),
+				{ "nation", "diplomatic_relation", sys::tick_tables::messages });
 			break;
 		case 8:
-			military::apply_attrition(*this);
+			graph.add(monthly_tick_phase_names[8], [&](sys::state&) { military::apply_attrition(*this); },
+				military_reads, { "regiment", "ship" });
 			break;
 		case 9:
-			military::repair_ships(*this);
+			graph.add(monthly_tick_phase_names[9], [&](sys::state&) { military::repair_ships(*this); },
+				{ "nation", "province", "army", "regiment", "navy", "navy_control", "navy_location", "navy_membership", "ship" },
+				{ "regiment", "ship" });
 			break;
 		case 10:
-			province::update_crimes(*this);
+			graph.add(monthly_tick_phase_names[10], [&](sys::state&) { province::update_crimes(*this); },
+				{ sys::tick_tables::everything }, // evaluates crime triggers
+				{ "province.crime", "nation.central_crime_count" });
 			break;
 		case 11:
-			province::update_nationalism(*this);
+			graph.add(monthly_tick_phase_names[11], [&](sys::state&) { province::update_nationalism(*this); },
+				{ "province" },
+				{ "province.nationalism" });
 			break;
 		case 12:
-			ai::update_ai_research(*this);
-			rebel::update_armies(*this);
-			rebel::rebel_hunting_check(*this);
+			graph.add(monthly_tick_phase_names[12], [&](sys::state&) {
+				ai::update_ai_research(*this);
+				rebel::update_armies(*this);
+				rebel::rebel_hunting_check(*this);
+			}, sys::tick_tables_join({ military_reads, pop_tables, { "technology", "rebel_type", "culture_group_membership" } }),
+				{ "nation.current_research", "army", "navy" });
 			break;
 		case 13:
-			ai::perform_influence_actions(*this);
+			graph.add(monthly_tick_phase_names[13], [&](sys::state&) { ai::perform_influence_actions(*this); },
+				{ sys::tick_tables::everything }, // evaluates cb triggers
+				{ "gp_relationship", "diplomatic_relation", "nation", sys::tick_tables::messages });
 			break;
 		case 14:
-			ai::update_focuses(*this);
+			graph.add(monthly_tick_phase_names[14], [&](sys::state&) { ai::update_focuses(*this); },
+				{ sys::tick_tables::everything }, // evaluates focus triggers
+				{ "state_instance.owner_focus" });
 			break;
 		case 15:
-			culture::discover_inventions(*this);
+			graph.add(monthly_tick_phase_names[15], [&](sys::state&) { culture::discover_inventions(*this); },
+				{ sys::tick_tables::everything }, // evaluates invention chances
+				{ "nation", sys::tick_tables::messages });
 			break;
 		case 16:
-			ai::build_ships(*this);
+			graph.add(monthly_tick_phase_names[16], [&](sys::state&) { ai::build_ships(*this); },
+				sys::tick_tables_join({ unit_tables, map_tables, { "nation", "province_naval_construction" } }),
+				{ "province_naval_construction" });
 			break;
 		case 17:
-			ai::update_land_constructions(*this);
+			graph.add(monthly_tick_phase_names[17], [&](sys::state&) { ai::update_land_constructions(*this); },
+				sys::tick_tables_join({ unit_tables, map_tables, pop_tables, { "nation", "culture", "province_land_construction" } }),
+				{ "province_land_construction" });
 			break;
 		case 18:
-			ai::update_ai_econ_construction(*this);
+			graph.add(monthly_tick_phase_names[18], [&](sys::state&) { ai::update_ai_econ_construction(*this); },
+				sys::tick_tables_join({ map_tables, { "nation", "factory", "factory_location", "factory_type", "commodity", "market", "local_market",
+					"province_building_construction", "state_building_construction", "province_land_construction", "province_naval_construction" } }),
+				{ "province_building_construction", "state_building_construction", "state_instance" });
 			break;
 		case 19:
-			ai::update_budget(*this);
+			graph.add(monthly_tick_phase_names[19], [&](sys::state&) { ai::update_budget(*this); },
+				{ sys::tick_tables::everything }, // estimates the whole budget of each nation
+				{ "nation" });
 			break;
 		case 20:
-			nations::monthly_flashpoint_update(*this);
-			if(!bool(defines.alice_eval_ai_mil_everyday)) {
-				ai::make_defense(*this);
-			}
+			graph.add(monthly_tick_phase_names[20], [&](sys::state&) {
+				nations::monthly_flashpoint_update(*this);
+				if(!bool(defines.alice_eval_ai_mil_everyday)) {
+					ai::make_defense(*this);
+				}
+			}, { sys::tick_tables::everything }, // evaluates cb triggers
+				{ "nation", "state_instance.flashpoint_tag", "army" });
 			break;
 		case 21:
-			ai::update_ai_colony_starting(*this);
+			graph.add(monthly_tick_phase_names[21], [&](sys::state&) { ai::update_ai_colony_starting(*this); },
+				sys::tick_tables_join({ map_tables, { "nation", "colonization", "technology", "navy", "navy_control", "navy_membership", "ship",
+					"factory", "factory_location", sys::tick_tables::globals } }),
+				{ "colonization", "state_definition.colonization_stage" });
 			break;
 		case 22:
-			ai::take_reforms(*this);
+			graph.add(monthly_tick_phase_names[22], [&](sys::state&) { ai::take_reforms(*this); },
+				{ sys::tick_tables::everything }, { sys::tick_tables::everything }); // enacting issues runs their effects
 			break;
 		case 23:
-			ai::civilize(*this);
-			ai::make_war_decs(*this);
+			graph.add(monthly_tick_phase_names[23], [&](sys::state&) {
+				ai::civilize(*this);
+				ai::make_war_decs(*this);
+			}, { sys::tick_tables::everything }, { sys::tick_tables::everything }); // fires events, declares wars
 			break;
 		case 24:
-			rebel::execute_rebel_victories(*this);
-			if(!bool(defines.alice_eval_ai_mil_everyday)) {
-				ai::make_attacks(*this);
-			}
-			rebel::update_armies(*this);
-			rebel::rebel_hunting_check(*this);
+			graph.add(monthly_tick_phase_names[24], [&](sys::state&) {
+				rebel::execute_rebel_victories(*this);
+				if(!bool(defines.alice_eval_ai_mil_everyday)) {
+					ai::make_attacks(*this);
+				}
+				rebel::update_armies(*this);
+				rebel::rebel_hunting_check(*this);
+			}, { sys::tick_tables::everything }, { sys::tick_tables::everything }); // runs the rebel victory effects
 			break;
 		case 25:
-			rebel::execute_province_defections(*this);
+			graph.add(monthly_tick_phase_names[25], [&](sys::state&) { rebel::execute_province_defections(*this); },
+				{ sys::tick_tables::everything }, { sys::tick_tables::everything }); // changes province owners
 			break;
 		case 26:
-			ai::make_peace_offers(*this);
+			graph.add(monthly_tick_phase_names[26], [&](sys::state&) { ai::make_peace_offers(*this); },
+				{ sys::tick_tables::everything }, { sys::tick_tables::everything }); // accepted peace offers run their effects
 			break;
 		case 27:
-			ai::update_crisis_leaders(*this);
+			graph.add(monthly_tick_phase_names[27], [&](sys::state&) { ai::update_crisis_leaders(*this); },
+				{ sys::tick_tables::everything }, { sys::tick_tables::everything }); // may resolve the crisis
 			break;
 		case 28:
-			rebel::rebel_risings_check(*this);
+			graph.add(monthly_tick_phase_names[28], [&](sys::state&) { rebel::rebel_risings_check(*this); },
+				sys::tick_tables_join({ military_reads, pop_tables }),
+				sys::tick_tables_join({ unit_tables, battle_tables, { "rebel_faction.organization", sys::tick_tables::messages } }));
 			break;
 		case 29:
-			ai::update_war_intervention(*this);
+			graph.add(monthly_tick_phase_names[29], [&](sys::state&) { ai::update_war_intervention(*this); },
+				{ sys::tick_tables::everything }, { sys::tick_tables::everything }); // adding wargoals runs their effects
 			break;
 		case 30:
-			if(!bool(defines.alice_eval_ai_mil_everyday)) {
-				ai::update_ships(*this);
-			}
-			rebel::update_armies(*this);
-			rebel::rebel_hunting_check(*this);
+			graph.add(monthly_tick_phase_names[30], [&](sys::state&) {
+				if(!bool(defines.alice_eval_ai_mil_everyday)) {
+					ai::update_ships(*this);
+				}
+				rebel::update_armies(*this);
+				rebel::rebel_hunting_check(*this);
+			}, sys::tick_tables_join({ military_reads, pop_tables, { "rebel_type", "culture_group_membership" } }), unit_tables);
 			break;
 		case 31:
-			ai::update_cb_fabrication(*this);
-			ai::update_ai_ruling_party(*this);
+			graph.add(monthly_tick_phase_names[31], [&](sys::state&) {
+				ai::update_cb_fabrication(*this);
+				ai::update_ai_ruling_party(*this);
+			}, { sys::tick_tables::everything }, // evaluates cb and party triggers
+				{ "nation", "factory", "pop", "province", sys::tick_tables::messages });
 			break;
 		default:
 			break;
 		}
 
-		military::apply_regiment_damage(*this);
+		graph.add("apply_regiment_damage", [&](sys::state&) { military::apply_regiment_damage(*this); },
+			sys::tick_tables_join({ pop_tables, { "regiment", "regiment_source", "army", "army_membership", "army_control", "army_rebel_control",
+				"army_battle_participation", "land_battle", "culture", "ideology", "issue_option", "province", "nation", "rebellion_within",
+				"identity_holder" } }),
+			sys::tick_tables_join({ pop_tables, { "regiment", "regiment_source", "army_membership", "province_land_construction",
+				"nation.war_exhaustion", "province.demographics" } })); // destroyed regiments and emptied pops are deleted
 
 		if(ymd_date.day == 1) {
-			if(ymd_date.month == 1) {
-				// yearly update : redo the upper house
-				for(auto n : world.in_nation) {
-					if(n.get_owned_province_count() != 0)
-						politics::recalculate_upper_house(*this, n);
-				}
-
-				ai::update_influence_priorities(*this);
-				nations::generate_sea_trade_routes(*this);
-				nations::recalculate_markets_distance(*this);
-			}
-			if(ymd_date.month == 2) {
-				ai::upgrade_colonies(*this);
-			}
-			if(ymd_date.month == 3 && !national_definitions.on_quarterly_pulse.empty()) {
-				for(auto n : world.in_nation) {
-					if(n.get_owned_province_count() > 0) {
-						event::fire_fixed_event(*this, national_definitions.on_quarterly_pulse, trigger::to_generic(n.id), event::slot_type::nation, n.id, -1, event::slot_type::none);
+			graph.add("yearly_and_pulse_updates", [&](sys::state&) {
+				if(ymd_date.month == 1) {
+					// yearly update : redo the upper house
+					for(auto n : world.in_nation) {
+						if(n.get_owned_province_count() != 0)
+							politics::recalculate_upper_house(*this, n);
 					}
+
+					ai::update_influence_priorities(*this);
+					nations::generate_sea_trade_routes(*this);
+					nations::recalculate_markets_distance(*this);
 				}
-			}
-			if(ymd_date.month == 4 && ymd_date.year % 2 == 0) { // the purge
-				demographics::remove_small_pops(*this);
-			}
-			if(ymd_date.month == 5) {
-				ai::prune_alliances(*this);
-				ai::update_factory_types_priority(*this);
-			}
-			if(ymd_date.month == 6 && !national_definitions.on_quarterly_pulse.empty()) {
-				for(auto n : world.in_nation) {
-					if(n.get_owned_province_count() > 0) {
-						event::fire_fixed_event(*this, national_definitions.on_quarterly_pulse, trigger::to_generic(n.id), event::slot_type::nation, n.id, -1, event::slot_type::none);
-					}
+				if(ymd_date.month == 2) {
+					ai::upgrade_colonies(*this);
 				}
-			}
-			if(ymd_date.month == 7) {
-				ai::update_influence_priorities(*this);
-				nations::recalculate_markets_distance(*this);
-			}
-			if(ymd_date.month == 9 && !national_definitions.on_quarterly_pulse.empty()) {
-				for(auto n : world.in_nation) {
-					if(n.get_owned_province_count() > 0) {
-						event::fire_fixed_event(*this, national_definitions.on_quarterly_pulse, trigger::to_generic(n.id), event::slot_type::nation, n.id, -1, event::slot_type::none);
-					}
+				if(ymd_date.month == 3 && !national_definitions.on_quarterly_pulse.empty()) {
+					event::fire_fixed_event_for_all_nations(*this, national_definitions.on_quarterly_pulse);
 				}
-			}
-			if(ymd_date.month == 10 && !national_definitions.on_yearly_pulse.empty()) {
-				for(auto n : world.in_nation) {
-					if(n.get_owned_province_count() > 0) {
-						event::fire_fixed_event(*this, national_definitions.on_yearly_pulse, trigger::to_generic(n.id), event::slot_type::nation, n.id, -1, event::slot_type::none);
-					}
+				if(ymd_date.month == 4 && ymd_date.year % 2 == 0) { // the purge
+					demographics::remove_small_pops(*this);
+					if(defines.alice_compact_pops > 0.0f)
+						demographics::compact_pops(*this);
 				}
-			}
-			if(ymd_date.month == 11) {
-				ai::prune_alliances(*this);
-			}
-			if(ymd_date.month == 12 && !national_definitions.on_quarterly_pulse.empty()) {
-				for(auto n : world.in_nation) {
-					if(n.get_owned_province_count() > 0) {
-						event::fire_fixed_event(*this, national_definitions.on_quarterly_pulse, trigger::to_generic(n.id), event::slot_type::nation, n.id, -1, event::slot_type::none);
-					}
+				if(ymd_date.month == 5) {
+					ai::prune_alliances(*this);
+					ai::update_factory_types_priority(*this);
 				}
-			}
-		}
-
-		ai::general_ai_unit_tick(*this);
-
-		military::run_gc(*this);
-		nations::run_gc(*this);
-		military::update_blackflag_status(*this);
-		ai::daily_cleanup(*this);
-
-		province::update_connected_regions(*this);
-		province::update_cached_values(*this);
-		nations::update_cached_values(*this);
-
-	},
-	[&]() {
+				if(ymd_date.month == 6 && !national_definitions.on_quarterly_pulse.empty()) {
+					event::fire_fixed_event_for_all_nations(*this, national_definitions.on_quarterly_pulse);
+				}
+				if(ymd_date.month == 7) {
+					ai::update_influence_priorities(*this);
+					nations::recalculate_markets_distance(*this);
+				}
+				if(ymd_date.month == 9 && !national_definitions.on_quarterly_pulse.empty()) {
+					event::fire_fixed_event_for_all_nations(*this, national_definitions.on_quarterly_pulse);
+				}
+				if(ymd_date.month == 10 && !national_definitions.on_yearly_pulse.empty()) {
+					event::fire_fixed_event_for_all_nations(*this, national_definitions.on_yearly_pulse);
+				}
+				if(ymd_date.month == 11) {
+					ai::prune_alliances(*this);
+				}
+				if(ymd_date.month == 12 && !national_definitions.on_quarterly_pulse.empty()) {
+					event::fire_fixed_event_for_all_nations(*this, national_definitions.on_quarterly_pulse);
+				}
+			}, { sys::tick_tables::everything }, { sys::tick_tables::everything }); // the pulses fire events
+		}
+
+		graph.add("general_ai_unit_tick", [&](sys::state&) { ai::general_ai_unit_tick(*this); },
+			sys::tick_tables_join({ military_reads, { "state_definition" } }),
+			{ "army", "navy", "nation.ai_strategy" });
+		graph.add("cleanup", [&](sys::state&) {
+			military::run_gc(*this);
+			nations::run_gc(*this);
+			military::update_blackflag_status(*this);
+			ai::daily_cleanup(*this);
+		}, { sys::tick_tables::everything }, { sys::tick_tables::everything }); // ends wars and releases dead nations
+		graph.add("update_connected_regions", [&](sys::state&) { province::update_connected_regions(*this); },
+			{ "province", "province_adjacency", "province_ownership", "state_ownership", "abstract_state_membership", "state_instance", "nation_adjacency",
+				"war", "war_participant", "wargoal", "wargoals_attached", sys::tick_tables::globals },
+			{ "province.connected_region_id", "province.connected_coast_id", "nation_adjacency", "wargoal", "wargoals_attached", "peace_offer_item",
+				sys::tick_tables::globals }); // wargoals on provinces that are no longer owned are dropped
+		graph.add("update_cached_values", [&](sys::state&) {
+			province::update_cached_values(*this);
+			nations::update_cached_values(*this);
+		}, sys::tick_tables_join({ map_tables, diplomacy_tables, { "nation", "national_identity", "cultural_union_of", "factory_location",
+				"pop_location", sys::tick_tables::globals } }),
+			{ "nation", "national_identity.capital", "province.is_owner_core", "state_instance.capital", sys::tick_tables::globals });
+
+		if(cheat_data.verify_tick_stages)
+			graph.run_verified(*this);
+		else
+			graph.run(*this);
+	};
+	auto regenerate_alt = [&]() {
+		sys::tick_phase_scope phase{ tick_profile, "alt_regenerate_from_pop_data_daily" };
 		if(network_mode == network_mode_type::single_player)
 			demographics::alt_regenerate_from_pop_data_daily(*this);
+	};
+
+	if(cheat_data.verify_tick_stages) {
+		// the verifier hashes the whole data container after each stage, so nothing else may write to it while the stages run
+		regenerate_alt();
+		run_day();
+	} else {
+		concurrency::parallel_invoke(run_day, regenerate_alt);
 	}
-	);
 
 	if(network_mode == network_mode_type::single_player) {
 		world.nation_swap_demographics_demographics_alt();
@@ -4424,6 +4792,9 @@ void state::single_game_tick() {
 
 	game_state_updated.store(true, std::memory_order::release);
 
+	province::report_path_cache_stats(*this);
+	tick_profile.end_day();
+
 	switch(user_settings.autosaves) {
 	case autosave_frequency::none:
 		break;
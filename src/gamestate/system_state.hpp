@@ -32,6 +32,8 @@
 #include "network.hpp"
 #include "fif.hpp"
 #include "immediate_mode.hpp"
+#include "tick_profiler.hpp"
+#include "script_profiler.hpp"
 
 // this header will eventually contain the highest-level objects
 // that represent the overall state of the program
@@ -414,6 +416,7 @@ struct cheat_data_s {
 	bool instant_industry = false;
 	std::vector<dcon::nation_id> instant_research_nations;
 	bool daily_oos_check = false;
+	bool verify_tick_stages = false; // run the tick stages serially, checking their declared writes
 	bool province_names = false;
 
 	bool ecodump = false;
@@ -493,8 +496,11 @@ struct alignas(64) state {
 	absolute_time_point start_date;
 	absolute_time_point end_date;
 
-	std::vector<uint16_t> trigger_data;
+	std::vector<uint16_t> trigger_data; // as parsed; this is what the tooltips describe
 	std::vector<int32_t> trigger_data_indices;
+	// the same triggers, under the same keys, as rewritten by parsers::optimize_trigger_data; this is what is evaluated
+	std::vector<uint16_t> optimized_trigger_data;
+	std::vector<int32_t> optimized_trigger_data_indices;
 	std::vector<uint16_t> effect_data;
 	std::vector<int32_t> effect_data_indices;
 	std::vector<value_modifier_segment> value_modifier_segments;
@@ -525,6 +531,15 @@ struct alignas(64) state {
 #ifdef USE_LLVM
 	std::unique_ptr<fif::environment> jit_environment;
 #endif
+	// when set, every call into jit compiled code is also evaluated by the trigger interpreter and the results are compared
+	std::atomic<bool> jit_compare_mode = false;
+	std::atomic<int64_t> jit_comparisons = 0;
+	std::atomic<int64_t> jit_mismatches = 0;
+	void record_jit_comparison(float jit_result, float interpreter_result) {
+		jit_comparisons.fetch_add(1, std::memory_order_relaxed);
+		if(jit_result != interpreter_result)
+			jit_mismatches.fetch_add(1, std::memory_order_relaxed);
+	}
 
 	//
 	// Crisis data
@@ -565,6 +580,9 @@ struct alignas(64) state {
 	std::vector<event::pending_human_n_event> future_n_event;
 	std::vector<event::pending_human_p_event> future_p_event;
 
+	std::vector<event::event_trigger_guard> free_national_event_guards; // indexed by free_national_event_id
+	std::vector<event::event_trigger_guard> free_provincial_event_guards; // indexed by free_provincial_event_id
+
 	std::vector<int32_t> unit_names_indices; // indices for the names
 	std::vector<char> unit_names;
 	// a second text buffer, this time for just the unit names
@@ -625,6 +643,7 @@ struct alignas(64) state {
 	std::unique_ptr<window::window_data_impl> win_ptr = nullptr;     // platform-dependent window information
 	std::unique_ptr<sound::sound_impl> sound_ptr = nullptr;          // platform-dependent sound information
 	ui::state ui_state;                                              // transient information for the state of the ui
+	economy::estimate_cache ui_estimates;                            // budget estimates shown by the ui, see economy::cached
 	ogl::animation ui_animation;
 	text::font_manager font_collection;
 
@@ -676,9 +695,17 @@ struct alignas(64) state {
 	directx::data directx;
 #endif
 
+	// recently found land and naval paths
+	province::path_cache path_cache;
+
 	// cheat data
 	cheat_data_s cheat_data;
 
+	// per-phase timings of the daily tick
+	tick_profiler tick_profile;
+	// per-script timings of triggers, value modifiers and effects
+	script_profiler script_profile;
+
 	// network data
 	network::network_state network_state;
 
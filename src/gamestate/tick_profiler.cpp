@@ -0,0 +1,111 @@
+#include <algorithm>
+#include "tick_profiler.hpp"
+#include "simple_fs.hpp"
+
+namespace sys {
+
+void tick_profiler::begin_day(sys::date d) {
+	if(!enabled.load(std::memory_order_relaxed))
+		return;
+
+	std::lock_guard lg{ lock };
+	auto& day = history[recorded_days % history_days];
+	day.date = d;
+	day.total_microseconds = 0;
+	day.phases.clear();
+	day_start = std::chrono::steady_clock::now();
+	day_open = true;
+}
+
+void tick_profiler::end_day() {
+	if(!enabled.load(std::memory_order_relaxed))
+		return;
+
+	std::lock_guard lg{ lock };
+	if(!day_open) // enabled in the middle of the day
+		return;
+	auto& day = history[recorded_days % history_days];
+	day.total_microseconds = int64_t(std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - day_start).count());
+	++recorded_days;
+	day_open = false;
+}
+
+void tick_profiler::record(std::string_view name, int64_t microseconds, int32_t workers) {
+	std::lock_guard lg{ lock };
+	history[recorded_days % history_days].phases.push_back(tick_phase_sample{ name, microseconds, workers });
+}
+
+tick_day_record tick_profiler::most_recent_day() {
+	std::lock_guard lg{ lock };
+	return history[(recorded_days + history_days - 1) % history_days];
+}
+
+void tick_profiler::add_count(std::string_view name, int64_t value) {
+	std::lock_guard lg{ lock };
+	auto it = std::find_if(counters.begin(), counters.end(), [&](tick_counter const& c) { return c.name == name; });
+	if(it == counters.end())
+		counters.push_back(tick_counter{ name, value });
+	else
+		it->value += value;
+}
+
+void tick_profiler::reset() {
+	std::lock_guard lg{ lock };
+	counters.clear();
+	for(auto& d : history) {
+		d.phases.clear();
+		d.total_microseconds = 0;
+	}
+	recorded_days = 0;
+	day_open = false;
+}
+
+std::vector<tick_phase_summary> tick_profiler::summarize(int32_t days) {
+	std::vector<tick_phase_summary> result;
+
+	std::lock_guard lg{ lock };
+	days = std::min(std::min(days, recorded_days), history_days);
+	for(int32_t i = 1; i <= days; ++i) {
+		auto& day = history[(recorded_days - i) % history_days];
+		for(auto& p : day.phases) {
+			auto it = std::find_if(result.begin(), result.end(), [&](tick_phase_summary const& s) { return s.name == p.name; });
+			if(it == result.end()) {
+				result.push_back(tick_phase_summary{ p.name, 0, 0, 0, 0 });
+				it = result.end() - 1;
+			}
+			it->total_microseconds += p.microseconds;
+			it->max_microseconds = std::max(it->max_microseconds, p.microseconds);
+			it->max_workers = std::max(it->max_workers, p.workers);
+			++(it->samples);
+		}
+	}
+	std::sort(result.begin(), result.end(), [](tick_phase_summary const& a, tick_phase_summary const& b) {
+		if(a.total_microseconds != b.total_microseconds)
+			return a.total_microseconds > b.total_microseconds;
+		return a.name < b.name;
+	});
+	return result;
+}
+
+std::vector<tick_counter> tick_profiler::counter_totals() {
+	std::lock_guard lg{ lock };
+	return counters;
+}
+
+void tick_profiler::write_csv() {
+	std::string out = "date,day_total_us,phase,us,workers\n";
+	{
+		std::lock_guard lg{ lock };
+		auto days = std::min(recorded_days, history_days);
+		for(int32_t i = days; i >= 1; --i) {
+			auto& day = history[(recorded_days - i) % history_days];
+			for(auto& p : day.phases) {
+				out += std::to_string(day.date.value) + "," + std::to_string(day.total_microseconds) + "," + std::string(p.name) + "," + std::to_string(p.microseconds) + "," + std::to_string(p.workers) + "\n";
+			}
+		}
+	}
+	auto data_dumps_directory = simple_fs::get_or_create_data_dumps_directory();
+	simple_fs::write_file(data_dumps_directory, NATIVE("tick_profile.csv"), out.c_str(), uint32_t(out.size()));
+}
+
+} // namespace sys
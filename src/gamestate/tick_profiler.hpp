@@ -0,0 +1,115 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <vector>
+#include "date_interface.hpp"
+
+namespace sys {
+struct state;
+
+//
+// Optional timing of the individual phases of single_game_tick. When enabled, every stage of the tick graph and every explicitly
+// wrapped call records its wall time; the samples of the most recent days are kept for reporting from the console or dumping to
+// a csv file in the data dumps directory
+//
+
+struct tick_phase_sample {
+	std::string_view name; // must point to static storage
+	int64_t microseconds = 0;
+	int32_t workers = 0; // number of top level phases (including this one, unless it is nested) that were running when it started
+};
+
+struct tick_day_record {
+	sys::date date{ 0 };
+	int64_t total_microseconds = 0;
+	std::vector<tick_phase_sample> phases;
+};
+
+// running total of something counted during the tick, such as the hits of a cache
+struct tick_counter {
+	std::string_view name; // must point to static storage
+	int64_t value = 0;
+};
+
+struct tick_phase_summary {
+	std::string_view name;
+	int64_t total_microseconds = 0;
+	int64_t max_microseconds = 0;
+	int32_t samples = 0;
+	int32_t max_workers = 0;
+};
+
+struct tick_profiler {
+	static constexpr int32_t history_days = 128;
+
+	std::atomic<bool> enabled = false;
+	std::atomic<int32_t> active_phases = 0;
+	std::mutex lock;
+
+	std::array<tick_day_record, history_days> history;
+	int32_t recorded_days = 0; // total number of days recorded since the profiler was last reset
+	std::chrono::time_point<std::chrono::steady_clock> day_start;
+	bool day_open = false;
+	std::vector<tick_counter> counters; // totals since the profiler was last reset
+
+	void begin_day(sys::date d);
+	void end_day();
+	void record(std::string_view name, int64_t microseconds, int32_t workers);
+	void add_count(std::string_view name, int64_t value);
+	void reset();
+
+	tick_day_record most_recent_day();
+	// phase totals over the last `days` recorded days, sorted from the most to the least expensive
+	std::vector<tick_phase_summary> summarize(int32_t days);
+	std::vector<tick_counter> counter_totals();
+	// writes every recorded sample to tick_profile.csv in the data dumps directory
+	void write_csv();
+};
+
+// a nested phase times a part of a phase that is already being timed; it is recorded on its own, but does not count as a worker
+enum class tick_phase_kind : uint8_t {
+	top_level, nested
+};
+
+struct tick_phase_scope {
+	tick_profiler& profiler;
+	std::string_view name;
+	std::chrono::time_point<std::chrono::steady_clock> start;
+	int32_t workers = 0;
+	bool active = false;
+	bool nested = false;
+
+	tick_phase_scope(tick_profiler& profiler, std::string_view name, tick_phase_kind kind = tick_phase_kind::top_level) : profiler(profiler), name(name),
+		nested(kind == tick_phase_kind::nested) {
+		if(profiler.enabled.load(std::memory_order_relaxed)) {
+			active = true;
+			if(nested)
+				workers = profiler.active_phases.load(std::memory_order_relaxed);
+			else
+				workers = profiler.active_phases.fetch_add(1, std::memory_order_relaxed) + 1;
+			start = std::chrono::steady_clock::now();
+		}
+	}
+	~tick_phase_scope() {
+		finish();
+	}
+	// ends the phase before the scope does
+	void finish() {
+		if(active) {
+			active = false;
+			auto duration = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count();
+			if(!nested)
+				profiler.active_phases.fetch_sub(1, std::memory_order_relaxed);
+			profiler.record(name, int64_t(duration), workers);
+		}
+	}
+	tick_phase_scope(tick_phase_scope const&) = delete;
+	tick_phase_scope& operator=(tick_phase_scope const&) = delete;
+};
+
+} // namespace sys
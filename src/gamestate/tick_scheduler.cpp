@@ -0,0 +1,173 @@
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include "tick_scheduler.hpp"
+#include "system_state.hpp"
+#include "window.hpp"
+
+#ifdef _WIN64
+#include <ppl.h>
+#else
+#include "oneapi/tbb/task_group.h"
+#endif
+
+namespace sys {
+
+#ifdef _WIN64
+using stage_task_group = concurrency::task_group;
+#else
+using stage_task_group = tbb::task_group;
+#endif
+
+namespace {
+
+std::string_view table_object(std::string_view t) {
+	auto dot = t.find('.');
+	return dot == std::string_view::npos ? t : t.substr(0, dot);
+}
+std::string_view table_property(std::string_view t) {
+	auto dot = t.find('.');
+	return dot == std::string_view::npos ? std::string_view{} : t.substr(dot + 1);
+}
+
+bool any_overlap(std::vector<std::string_view> const& a, std::vector<std::string_view> const& b) {
+	for(auto x : a) {
+		for(auto y : b) {
+			if(tick_tables_overlap(x, y))
+				return true;
+		}
+	}
+	return false;
+}
+
+bool is_declared_write(tick_stage const& s, std::string_view object, std::string_view property) {
+	for(auto w : s.writes) {
+		if(w == tick_tables::everything)
+			return true;
+		if(table_object(w) == object && (table_property(w).empty() || table_property(w) == property))
+			return true;
+	}
+	return false;
+}
+
+struct column_hash {
+	std::string object;
+	std::string property;
+	uint64_t hash = 0;
+};
+
+// hashes every property of the data container that is part of a full (local) save
+std::vector<column_hash> hash_columns(sys::state& state) {
+	std::vector<column_hash> result;
+
+	dcon::load_record loaded = state.world.make_serialize_record_store_full_save();
+	auto buffer = std::unique_ptr<std::byte[]>(new std::byte[state.world.serialize_size(loaded)]);
+	std::byte* buffer_position = buffer.get();
+	state.world.serialize(buffer_position, loaded);
+
+	dcon::for_each_record(buffer.get(), buffer_position, [&](dcon::record_header const& header, std::byte const* data_start, std::byte const* data_end) {
+		uint64_t h = 0xcbf29ce484222325ull; // FNV-1a
+		for(auto p = data_start; p != data_end; ++p) {
+			h ^= uint64_t(*p);
+			h *= 0x100000001b3ull;
+		}
+		result.push_back(column_hash{
+			std::string(header.object_name_start, header.object_name_end),
+			std::string(header.property_name_start, header.property_name_end),
+			h });
+	});
+	return result;
+}
+
+} // namespace
+
+std::vector<std::string_view> tick_tables_join(std::initializer_list<std::vector<std::string_view>> groups) {
+	std::vector<std::string_view> result;
+	for(auto& g : groups)
+		result.insert(result.end(), g.begin(), g.end());
+	return result;
+}
+
+bool tick_tables_overlap(std::string_view a, std::string_view b) {
+	if(a == tick_tables::everything || b == tick_tables::everything)
+		return true;
+	if(table_object(a) != table_object(b))
+		return false;
+	auto pa = table_property(a);
+	auto pb = table_property(b);
+	return pa.empty() || pb.empty() || pa == pb;
+}
+
+bool tick_stages_conflict(tick_stage const& a, tick_stage const& b) {
+	return any_overlap(a.writes, b.writes) || any_overlap(a.writes, b.reads) || any_overlap(a.reads, b.writes);
+}
+
+void tick_graph::run(sys::state& state) {
+	auto const count = int32_t(stages.size());
+	if(count == 0)
+		return;
+
+	/*
+	Every stage depends on each earlier stage that it conflicts with. A stage is launched as soon as the last of the stages that
+	it depends on has finished, from the thread that finished it, so no worker ever blocks waiting for another stage.
+	*/
+	std::vector<std::vector<int32_t>> successors(size_t(count));
+	auto pending = std::unique_ptr<std::atomic<int32_t>[]>(new std::atomic<int32_t>[size_t(count)]);
+	for(int32_t j = 0; j < count; ++j) {
+		int32_t dependencies = 0;
+		for(int32_t i = 0; i < j; ++i) {
+			if(tick_stages_conflict(stages[i], stages[j])) {
+				successors[i].push_back(j);
+				++dependencies;
+			}
+		}
+		pending[j].store(dependencies, std::memory_order_relaxed);
+	}
+
+	stage_task_group group;
+	std::function<void(int32_t)> launch = [&](int32_t index) {
+		group.run([&, index]() {
+			{
+				tick_phase_scope scope{ state.tick_profile, stages[index].name };
+				stages[index].run(state);
+			}
+			for(auto s : successors[index]) {
+				if(pending[s].fetch_sub(1, std::memory_order_acq_rel) == 1)
+					launch(s);
+			}
+		});
+	};
+	for(int32_t j = 0; j < count; ++j) {
+		if(pending[j].load(std::memory_order_relaxed) == 0)
+			launch(j);
+	}
+	group.wait();
+
+	stages.clear();
+}
+
+void tick_graph::run_verified(sys::state& state) {
+	auto before = hash_columns(state);
+	for(auto& s : stages) {
+		{
+			tick_phase_scope scope{ state.tick_profile, s.name };
+			s.run(state);
+		}
+		auto after = hash_columns(state);
+
+		std::string violations;
+		for(size_t i = 0; i < std::min(before.size(), after.size()); ++i) {
+			if(before[i].hash != after[i].hash && !is_declared_write(s, after[i].object, after[i].property)) {
+				violations += after[i].object + "." + after[i].property + "\n";
+			}
+		}
+		if(!violations.empty()) {
+			window::emit_error_message("Tick stage " + std::string(s.name) + " wrote to undeclared data:\n" + violations, true);
+		}
+
+		before = std::move(after);
+	}
+	stages.clear();
+}
+
+} // namespace sys
@@ -0,0 +1,59 @@
+#pragma once
+
+#include <functional>
+#include <initializer_list>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace sys {
+struct state;
+
+//
+// The daily tick is described as a list of stages, each of which declares the parts of the game state it reads from and writes to.
+// A part is either a whole dcon object or relationship ("nation"), a single property of one ("nation.research_points"),
+// or one of the pseudo tables below for data that lives outside of the data container. Two stages conflict when one of them
+// writes a part that the other reads or writes; conflicting stages always run in the order in which they were added, everything
+// else is free to run concurrently. As a result the outcome is identical to running the stages one after the other in the order
+// in which they were added (provided that the declarations are accurate)
+//
+
+namespace tick_tables {
+
+inline constexpr std::string_view everything = "*";
+inline constexpr std::string_view messages = "$messages"; // notification / battle report queues; these are single producer
+inline constexpr std::string_view events = "$events"; // pending and future event lists
+inline constexpr std::string_view globals = "$globals"; // crisis data, great powers, rankings, cached flags, etc in sys::state
+
+} // namespace tick_tables
+
+struct tick_stage {
+	std::string_view name;
+	std::function<void(sys::state&)> run;
+	std::vector<std::string_view> reads;
+	std::vector<std::string_view> writes;
+};
+
+struct tick_graph {
+	std::vector<tick_stage> stages;
+
+	void add(std::string_view name, std::function<void(sys::state&)>&& fn, std::vector<std::string_view> reads, std::vector<std::string_view> writes) {
+		stages.push_back(tick_stage{ name, std::move(fn), std::move(reads), std::move(writes) });
+	}
+	void clear() {
+		stages.clear();
+	}
+
+	// runs all of the stages, then clears them
+	void run(sys::state& state);
+	// runs all of the stages one by one, checking after each that it only changed the parts of the data container it declared as
+	// written to; any violation is reported as a fatal error (the pseudo tables cannot be checked this way)
+	void run_verified(sys::state& state);
+};
+
+// concatenates several lists of parts, so that stages can share groups of tables in their declarations
+std::vector<std::string_view> tick_tables_join(std::initializer_list<std::vector<std::string_view>> groups);
+bool tick_tables_overlap(std::string_view a, std::string_view b);
+bool tick_stages_conflict(tick_stage const& a, tick_stage const& b);
+
+} // namespace sys
@@ -1798,13 +1798,13 @@ void budgetwindow_main_income_amount_t::on_update(sys::state& state) noexcept {
 	budgetwindow_main_t& main = *((budgetwindow_main_t*)(parent)); 
 // BEGIN main::income_amount::update
 	float total = 0.0f;
-	total += economy::estimate_diplomatic_income(state, state.local_player_nation);
-	total += economy::estimate_tax_income_by_strata(state, state.local_player_nation, culture::pop_strata::poor) * float(state.world.nation_get_poor_tax(state.local_player_nation)) / 100.0f;
-	total += economy::estimate_tax_income_by_strata(state, state.local_player_nation, culture::pop_strata::middle) * float(state.world.nation_get_middle_tax(state.local_player_nation)) / 100.0f;
-	total += economy::estimate_tax_income_by_strata(state, state.local_player_nation, culture::pop_strata::rich) * float(state.world.nation_get_rich_tax(state.local_player_nation)) / 100.0f;
-	total += economy::estimate_tariff_import_income(state, state.local_player_nation);
-	total += economy::estimate_tariff_export_income(state, state.local_player_nation);
-	total += economy::estimate_gold_income(state, state.local_player_nation);
+	total += economy::cached::estimate_diplomatic_income(state, state.local_player_nation);
+	total += economy::cached::estimate_tax_income_by_strata(state, state.local_player_nation, culture::pop_strata::poor) * float(state.world.nation_get_poor_tax(state.local_player_nation)) / 100.0f;
+	total += economy::cached::estimate_tax_income_by_strata(state, state.local_player_nation, culture::pop_strata::middle) * float(state.world.nation_get_middle_tax(state.local_player_nation)) / 100.0f;
+	total += economy::cached::estimate_tax_income_by_strata(state, state.local_player_nation, culture::pop_strata::rich) * float(state.world.nation_get_rich_tax(state.local_player_nation)) / 100.0f;
+	total += economy::cached::estimate_tariff_import_income(state, state.local_player_nation);
+	total += economy::cached::estimate_tariff_export_income(state, state.local_player_nation);
+	total += economy::cached::estimate_gold_income(state, state.local_player_nation);
 	set_text(state, text::prettify_currency(total));
 // END
 }
@@ -2344,7 +2344,7 @@ void budgetwindow_main_income_table_t::on_update(sys::state& state) noexcept {
 	add_insert_section_header(state, budget_categories::poor_tax);
 	if(budget_categories::expanded[budget_categories::poor_tax]) {
 		add_insert_top_spacer(state);
-		auto total = economy::estimate_tax_income_by_strata(state, state.local_player_nation, culture::pop_strata::poor) * float(state.world.nation_get_poor_tax(state.local_player_nation)) / 100.0f;
+		auto total = economy::cached::estimate_tax_income_by_strata(state, state.local_player_nation, culture::pop_strata::poor) * float(state.world.nation_get_poor_tax(state.local_player_nation)) / 100.0f;
 		auto type_totals = state.world.pop_type_make_vectorizable_float_buffer();
 		auto all_totals = 0.0f;
 
@@ -2373,7 +2373,7 @@ void budgetwindow_main_income_table_t::on_update(sys::state& state) noexcept {
 	if(budget_categories::expanded[budget_categories::middle_tax]) {
 		add_insert_top_spacer(state);
 
-		auto total = economy::estimate_tax_income_by_strata(state, state.local_player_nation, culture::pop_strata::middle) * float(state.world.nation_get_middle_tax(state.local_player_nation)) / 100.0f;
+		auto total = economy::cached::estimate_tax_income_by_strata(state, state.local_player_nation, culture::pop_strata::middle) * float(state.world.nation_get_middle_tax(state.local_player_nation)) / 100.0f;
 		auto type_totals = state.world.pop_type_make_vectorizable_float_buffer();
 		auto all_totals = 0.0f;
 
@@ -2401,7 +2401,7 @@ void budgetwindow_main_income_table_t::on_update(sys::state& state) noexcept {
 	add_insert_section_header(state, budget_categories::rich_tax);
 	if(budget_categories::expanded[budget_categories::rich_tax]) {
 		add_insert_top_spacer(state);
-		auto total = economy::estimate_tax_income_by_strata(state, state.local_player_nation, culture::pop_strata::rich) * float(state.world.nation_get_rich_tax(state.local_player_nation)) / 100.0f;
+		auto total = economy::cached::estimate_tax_income_by_strata(state, state.local_player_nation, culture::pop_strata::rich) * float(state.world.nation_get_rich_tax(state.local_player_nation)) / 100.0f;
 		auto type_totals = state.world.pop_type_make_vectorizable_float_buffer();
 		auto all_totals = 0.0f;
 
@@ -2481,14 +2481,14 @@ void budgetwindow_main_income_table_t::on_update(sys::state& state) noexcept {
 	add_insert_section_header(state, budget_categories::diplomatic_income);
 	if(budget_categories::expanded[budget_categories::diplomatic_income]) {
 		add_insert_top_spacer(state);
-		add_value(std::pair<std::string, float>(text::produce_simple_string(state, "warsubsidies_button"), economy::estimate_war_subsidies_income(state, state.local_player_nation)));
-		add_value(std::pair<std::string, float>(text::produce_simple_string(state, "alice_budget_indemnities"), economy::estimate_reparations_income(state, state.local_player_nation)));
+		add_value(std::pair<std::string, float>(text::produce_simple_string(state, "warsubsidies_button"), economy::cached::estimate_war_subsidies_income(state, state.local_player_nation)));
+		add_value(std::pair<std::string, float>(text::produce_simple_string(state, "alice_budget_indemnities"), economy::cached::estimate_reparations_income(state, state.local_player_nation)));
 		for(auto n : state.world.in_nation) {
 			auto rel = state.world.nation_get_overlord_as_subject(n);
 			auto overlord = state.world.overlord_get_ruler(rel);
 
 			if(overlord == state.local_player_nation) {
-				auto transferamt = economy::estimate_subject_payments_paid(state, n);
+				auto transferamt = economy::cached::estimate_subject_payments_paid(state, n);
 
 				add_value(std::pair<std::string, float>(text::produce_simple_string(state, "from") + " " + text::produce_simple_string(state, n.get_identity_from_identity_holder().get_name()), transferamt));
 			}
@@ -2671,19 +2671,19 @@ void budgetwindow_main_expenses_amount_t::on_update(sys::state& state) noexcept
 	budgetwindow_main_t& main = *((budgetwindow_main_t*)(parent)); 
 // BEGIN main::expenses_amount::update
 	float total = 0.0f;
-	total += economy::estimate_diplomatic_expenses(state, state.local_player_nation); 
-	total += economy::estimate_social_spending(state, state.local_player_nation) * float(state.world.nation_get_social_spending(state.local_player_nation)) / 100.0f;
-	total += economy::estimate_pop_payouts_by_income_type(state, state.local_player_nation, culture::income_type::military) * float(state.world.nation_get_military_spending(state.local_player_nation)) / 100.0f;
-	total += economy::estimate_pop_payouts_by_income_type(state, state.local_player_nation, culture::income_type::education) * float(state.world.nation_get_education_spending(state.local_player_nation)) / 100.0f;
-	total += economy::estimate_pop_payouts_by_income_type(state, state.local_player_nation, culture::income_type::administration) * float(state.world.nation_get_administrative_spending(state.local_player_nation)) / 100.0f;
-	total += economy::estimate_domestic_investment(state, state.local_player_nation) * float(state.world.nation_get_domestic_investment_spending(state.local_player_nation)) / 100.0f;
-	total += economy::estimate_overseas_penalty_spending(state, state.local_player_nation) * float(state.world.nation_get_overseas_spending(state.local_player_nation)) / 100.0f;
-	total += economy::estimate_subsidy_spending(state, state.local_player_nation);
-	total += economy::estimate_construction_spending(state, state.local_player_nation) * float(state.world.nation_get_construction_spending(state.local_player_nation)) / 100.0f;
-	total += economy::estimate_land_spending(state, state.local_player_nation) * float(state.world.nation_get_land_spending(state.local_player_nation)) / 100.0f;
-	total += economy::estimate_naval_spending(state, state.local_player_nation) * float(state.world.nation_get_naval_spending(state.local_player_nation)) / 100.0f;
+	total += economy::cached::estimate_diplomatic_expenses(state, state.local_player_nation); 
+	total += economy::cached::estimate_social_spending(state, state.local_player_nation) * float(state.world.nation_get_social_spending(state.local_player_nation)) / 100.0f;
+	total += economy::cached::estimate_pop_payouts_by_income_type(state, state.local_player_nation, culture::income_type::military) * float(state.world.nation_get_military_spending(state.local_player_nation)) / 100.0f;
+	total += economy::cached::estimate_pop_payouts_by_income_type(state, state.local_player_nation, culture::income_type::education) * float(state.world.nation_get_education_spending(state.local_player_nation)) / 100.0f;
+	total += economy::cached::estimate_pop_payouts_by_income_type(state, state.local_player_nation, culture::income_type::administration) * float(state.world.nation_get_administrative_spending(state.local_player_nation)) / 100.0f;
+	total += economy::cached::estimate_domestic_investment(state, state.local_player_nation) * float(state.world.nation_get_domestic_investment_spending(state.local_player_nation)) / 100.0f;
+	total += economy::cached::estimate_overseas_penalty_spending(state, state.local_player_nation) * float(state.world.nation_get_overseas_spending(state.local_player_nation)) / 100.0f;
+	total += economy::cached::estimate_subsidy_spending(state, state.local_player_nation);
+	total += economy::cached::estimate_construction_spending(state, state.local_player_nation) * float(state.world.nation_get_construction_spending(state.local_player_nation)) / 100.0f;
+	total += economy::cached::estimate_land_spending(state, state.local_player_nation) * float(state.world.nation_get_land_spending(state.local_player_nation)) / 100.0f;
+	total += economy::cached::estimate_naval_spending(state, state.local_player_nation) * float(state.world.nation_get_naval_spending(state.local_player_nation)) / 100.0f;
 	total += economy::interest_payment(state, state.local_player_nation);
-	total += economy::estimate_stockpile_filling_spending(state, state.local_player_nation);
+	total += economy::cached::estimate_stockpile_filling_spending(state, state.local_player_nation);
 	set_text(state, text::prettify_currency(total));
 // END
 }
@@ -3406,9 +3406,9 @@ void budgetwindow_main_expenses_table_t::on_update(sys::state& state) noexcept {
 	add_insert_section_header(state, budget_categories::diplomatic_expenses);
 	if(budget_categories::expanded[budget_categories::diplomatic_expenses]) {
 		add_insert_top_spacer(state);
-		add_value(std::pair<std::string, float>(text::produce_simple_string(state, "warsubsidies_button"), economy::estimate_war_subsidies_spending(state, state.local_player_nation)));
-		add_value(std::pair<std::string, float>(text::produce_simple_string(state, "alice_budget_indemnities"), economy::estimate_reparations_spending(state, state.local_player_nation)));
-		add_value(std::pair<std::string, float>(text::produce_simple_string(state, "alice_budget_overlord"), economy::estimate_subject_payments_paid(state, state.local_player_nation)));
+		add_value(std::pair<std::string, float>(text::produce_simple_string(state, "warsubsidies_button"), economy::cached::estimate_war_subsidies_spending(state, state.local_player_nation)));
+		add_value(std::pair<std::string, float>(text::produce_simple_string(state, "alice_budget_indemnities"), economy::cached::estimate_reparations_spending(state, state.local_player_nation)));
+		add_value(std::pair<std::string, float>(text::produce_simple_string(state, "alice_budget_overlord"), economy::cached::estimate_subject_payments_paid(state, state.local_player_nation)));
 		add_insert_bottom_spacer(state);
 	} else {
 		add_insert_neutral_spacer(state);
@@ -5774,26 +5774,26 @@ void budgetwindow_section_header_expand_button_t::on_update(sys::state& state) n
 	budgetwindow_section_header_t& section_header = *((budgetwindow_section_header_t*)(parent)); 
 // BEGIN section_header::expand_button::update
 	switch(section_header.section_type) {
-	case budget_categories::diplomatic_income: disabled = (economy::estimate_diplomatic_income(state, state.local_player_nation) <= 0); break;
+	case budget_categories::diplomatic_income: disabled = (economy::cached::estimate_diplomatic_income(state, state.local_player_nation) <= 0); break;
 	case budget_categories::poor_tax: disabled = false; break;
 	case budget_categories::middle_tax: disabled = false; break;
 	case budget_categories::rich_tax: disabled = false; break;
-	case budget_categories::tariffs_import: disabled = (economy::estimate_tariff_import_income(state, state.local_player_nation) <= 0); break;
-	case budget_categories::tariffs_export: disabled = (economy::estimate_tariff_export_income(state, state.local_player_nation) <= 0); break;
-	case budget_categories::gold: disabled = (economy::estimate_gold_income(state, state.local_player_nation) <= 0); break;
-	case budget_categories::diplomatic_expenses: disabled = (economy::estimate_diplomatic_expenses(state, state.local_player_nation) <= 0); break;
-	case budget_categories::social: disabled = (economy::estimate_social_spending(state, state.local_player_nation) <= 0); break;
+	case budget_categories::tariffs_import: disabled = (economy::cached::estimate_tariff_import_income(state, state.local_player_nation) <= 0); break;
+	case budget_categories::tariffs_export: disabled = (economy::cached::estimate_tariff_export_income(state, state.local_player_nation) <= 0); break;
+	case budget_categories::gold: disabled = (economy::cached::estimate_gold_income(state, state.local_player_nation) <= 0); break;
+	case budget_categories::diplomatic_expenses: disabled = (economy::cached::estimate_diplomatic_expenses(state, state.local_player_nation) <= 0); break;
+	case budget_categories::social: disabled = (economy::cached::estimate_social_spending(state, state.local_player_nation) <= 0); break;
 	case budget_categories::military: disabled = false; break;
 	case budget_categories::education: disabled = false; break;
 	case budget_categories::admin: disabled = false; break;
 	case budget_categories::domestic_investment: disabled = false; break;
-	case budget_categories::overseas_spending: disabled = (economy::estimate_overseas_penalty_spending(state, state.local_player_nation) <= 0); break;
-	case budget_categories::subsidies: disabled = (economy::estimate_subsidy_spending(state, state.local_player_nation) <= 0); break;
-	case budget_categories::construction: disabled = (economy::estimate_construction_spending(state, state.local_player_nation) <= 0); break;
-	case budget_categories::army_upkeep: disabled = (economy::estimate_land_spending(state, state.local_player_nation) <= 0); break;
-	case budget_categories::navy_upkeep:disabled = (economy::estimate_naval_spending(state, state.local_player_nation) <= 0); break;
+	case budget_categories::overseas_spending: disabled = (economy::cached::estimate_overseas_penalty_spending(state, state.local_player_nation) <= 0); break;
+	case budget_categories::subsidies: disabled = (economy::cached::estimate_subsidy_spending(state, state.local_player_nation) <= 0); break;
+	case budget_categories::construction: disabled = (economy::cached::estimate_construction_spending(state, state.local_player_nation) <= 0); break;
+	case budget_categories::army_upkeep: disabled = (economy::cached::estimate_land_spending(state, state.local_player_nation) <= 0); break;
+	case budget_categories::navy_upkeep:disabled = (economy::cached::estimate_naval_spending(state, state.local_player_nation) <= 0); break;
 	case budget_categories::debt_payment: disabled = (economy::interest_payment(state, state.local_player_nation) <= 0); break;
-	case budget_categories::stockpile: disabled = (economy::estimate_stockpile_filling_spending(state, state.local_player_nation) <= 0);  break;
+	case budget_categories::stockpile: disabled = (economy::cached::estimate_stockpile_filling_spending(state, state.local_player_nation) <= 0);  break;
 	default: disabled = false; break;
 	}
 
@@ -5831,26 +5831,26 @@ void budgetwindow_section_header_total_amount_t::on_update(sys::state& state) no
 	budgetwindow_section_header_t& section_header = *((budgetwindow_section_header_t*)(parent)); 
 // BEGIN section_header::total_amount::update
 	switch(section_header.section_type) {
-	case budget_categories::diplomatic_income: set_text(state, text::prettify_currency(economy::estimate_diplomatic_income(state, state.local_player_nation))); break;
-	case budget_categories::poor_tax: set_text(state, text::prettify_currency(economy::estimate_tax_income_by_strata(state, state.local_player_nation, culture::pop_strata::poor) * float(state.world.nation_get_poor_tax(state.local_player_nation)) / 100.0f)); break;
-	case budget_categories::middle_tax: set_text(state, text::prettify_currency(economy::estimate_tax_income_by_strata(state, state.local_player_nation, culture::pop_strata::middle) * float(state.world.nation_get_middle_tax(state.local_player_nation)) / 100.0f)); break;
-	case budget_categories::rich_tax: set_text(state, text::prettify_currency(economy::estimate_tax_income_by_strata(state, state.local_player_nation, culture::pop_strata::rich) * float(state.world.nation_get_rich_tax(state.local_player_nation)) / 100.0f)); break;
-	case budget_categories::tariffs_import: set_text(state, text::prettify_currency(economy::estimate_tariff_import_income(state, state.local_player_nation))); break;
-	case budget_categories::tariffs_export: set_text(state, text::prettify_currency(economy::estimate_tariff_export_income(state, state.local_player_nation))); break;
-	case budget_categories::gold: set_text(state, text::prettify_currency(economy::estimate_gold_income(state, state.local_player_nation))); break;
-	case budget_categories::diplomatic_expenses: set_text(state, text::prettify_currency(economy::estimate_diplomatic_expenses(state, state.local_player_nation))); break;
-	case budget_categories::social: set_text(state,  text::prettify_currency(economy::estimate_social_spending(state, state.local_player_nation) * float(state.world.nation_get_social_spending(state.local_player_nation)) / 100.0f)); break;
-	case budget_categories::military: set_text(state, text::prettify_currency(economy::estimate_pop_payouts_by_income_type(state, state.local_player_nation, culture::income_type::military) * float(state.world.nation_get_military_spending(state.local_player_nation)) / 100.0f)); break;
-	case budget_categories::education: set_text(state, text::prettify_currency(economy::estimate_pop_payouts_by_income_type(state, state.local_player_nation, culture::income_type::education) * float(state.world.nation_get_education_spending(state.local_player_nation)) / 100.0f)); break;
-	case budget_categories::admin: set_text(state, text::prettify_currency(economy::estimate_pop_payouts_by_income_type(state, state.local_player_nation, culture::income_type::administration) * float(state.world.nation_get_administrative_spending(state.local_player_nation)) / 100.0f)); break;
-	case budget_categories::domestic_investment: set_text(state, text::prettify_currency(economy::estimate_domestic_investment(state, state.local_player_nation) * float(state.world.nation_get_domestic_investment_spending(state.local_player_nation)) / 100.0f)); break;
-	case budget_categories::overseas_spending: set_text(state, text::prettify_currency(economy::estimate_overseas_penalty_spending(state, state.local_player_nation) * float(state.world.nation_get_overseas_spending(state.local_player_nation)) / 100.0f)); break;
-	case budget_categories::subsidies: set_text(state, text::prettify_currency(economy::estimate_subsidy_spending(state, state.local_player_nation))); break;
-	case budget_categories::construction: set_text(state, text::prettify_currency(economy::estimate_construction_spending(state, state.local_player_nation) * float(state.world.nation_get_construction_spending(state.local_player_nation)) / 100.0f)); break;
-	case budget_categories::army_upkeep: set_text(state, text::prettify_currency(economy::estimate_land_spending(state, state.local_player_nation) * float(state.world.nation_get_land_spending(state.local_player_nation)) / 100.0f)); break;
-	case budget_categories::navy_upkeep: set_text(state, text::prettify_currency(economy::estimate_naval_spending(state, state.local_player_nation) * float(state.world.nation_get_naval_spending(state.local_player_nation)) / 100.0f)); break;
+	case budget_categories::diplomatic_income: set_text(state, text::prettify_currency(economy::cached::estimate_diplomatic_income(state, state.local_player_nation))); break;
+	case budget_categories::poor_tax: set_text(state, text::prettify_currency(economy::cached::estimate_tax_income_by_strata(state, state.local_player_nation, culture::pop_strata::poor) * float(state.world.nation_get_poor_tax(state.local_player_nation)) / 100.0f)); break;
+	case budget_categories::middle_tax: set_text(state, text::prettify_currency(economy::cached::estimate_tax_income_by_strata(state, state.local_player_nation, culture::pop_strata::middle) * float(state.world.nation_get_middle_tax(state.local_player_nation)) / 100.0f)); break;
+	case budget_categories::rich_tax: set_text(state, text::prettify_currency(economy::cached::estimate_tax_income_by_strata(state, state.local_player_nation, culture::pop_strata::rich) * float(state.world.nation_get_rich_tax(state.local_player_nation)) / 100.0f)); break;
+	case budget_categories::tariffs_import: set_text(state, text::prettify_currency(economy::cached::estimate_tariff_import_income(state, state.local_player_nation))); break;
+	case budget_categories::tariffs_export: set_text(state, text::prettify_currency(economy::cached::estimate_tariff_export_income(state, state.local_player_nation))); break;
+	case budget_categories::gold: set_text(state, text::prettify_currency(economy::cached::estimate_gold_income(state, state.local_player_nation))); break;
+	case budget_categories::diplomatic_expenses: set_text(state, text::prettify_currency(economy::cached::estimate_diplomatic_expenses(state, state.local_player_nation))); break;
+	case budget_categories::social: set_text(state,  text::prettify_currency(economy::cached::estimate_social_spending(state, state.local_player_nation) * float(state.world.nation_get_social_spending(state.local_player_nation)) / 100.0f)); break;
+	case budget_categories::military: set_text(state, text::prettify_currency(economy::cached::estimate_pop_payouts_by_income_type(state, state.local_player_nation, culture::income_type::military) * float(state.world.nation_get_military_spending(state.local_player_nation)) / 100.0f)); break;
+	case budget_categories::education: set_text(state, text::prettify_currency(economy::cached::estimate_pop_payouts_by_income_type(state, state.local_player_nation, culture::income_type::education) * float(state.world.nation_get_education_spending(state.local_player_nation)) / 100.0f)); break;
+	case budget_categories::admin: set_text(state, text::prettify_currency(economy::cached::estimate_pop_payouts_by_income_type(state, state.local_player_nation, culture::income_type::administration) * float(state.world.nation_get_administrative_spending(state.local_player_nation)) / 100.0f)); break;
+	case budget_categories::domestic_investment: set_text(state, text::prettify_currency(economy::cached::estimate_domestic_investment(state, state.local_player_nation) * float(state.world.nation_get_domestic_investment_spending(state.local_player_nation)) / 100.0f)); break;
+	case budget_categories::overseas_spending: set_text(state, text::prettify_currency(economy::cached::estimate_overseas_penalty_spending(state, state.local_player_nation) * float(state.world.nation_get_overseas_spending(state.local_player_nation)) / 100.0f)); break;
+	case budget_categories::subsidies: set_text(state, text::prettify_currency(economy::cached::estimate_subsidy_spending(state, state.local_player_nation))); break;
+	case budget_categories::construction: set_text(state, text::prettify_currency(economy::cached::estimate_construction_spending(state, state.local_player_nation) * float(state.world.nation_get_construction_spending(state.local_player_nation)) / 100.0f)); break;
+	case budget_categories::army_upkeep: set_text(state, text::prettify_currency(economy::cached::estimate_land_spending(state, state.local_player_nation) * float(state.world.nation_get_land_spending(state.local_player_nation)) / 100.0f)); break;
+	case budget_categories::navy_upkeep: set_text(state, text::prettify_currency(economy::cached::estimate_naval_spending(state, state.local_player_nation) * float(state.world.nation_get_naval_spending(state.local_player_nation)) / 100.0f)); break;
 	case budget_categories::debt_payment: set_text(state, text::prettify_currency(economy::interest_payment(state, state.local_player_nation))); break;
-	case budget_categories::stockpile: set_text(state, text::prettify_currency(economy::estimate_stockpile_filling_spending(state, state.local_player_nation))); break;
+	case budget_categories::stockpile: set_text(state, text::prettify_currency(economy::cached::estimate_stockpile_filling_spending(state, state.local_player_nation))); break;
 	default: set_text(state, ""); break;
 	}
 // END
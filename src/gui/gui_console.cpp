@@ -639,6 +639,178 @@ int32_t* f_daily_oos(fif::state_stack& s, int32_t* p, fif::environment* e) {
 	state->cheat_data.daily_oos_check = toggle_state;
 	return p + 2;
 }
+int32_t* f_verify_tick_stages(fif::state_stack& s, int32_t* p, fif::environment* e) {
+	if(fif::typechecking_mode(e->mode)) {
+		if(fif::typechecking_failed(e->mode))
+			return p + 2;
+		s.pop_main();
+		return p + 2;
+	}
+
+	auto state_global = fif::get_global_var(*e, "state-ptr");
+	sys::state* state = (sys::state*)(state_global->data);
+
+	bool toggle_state = s.main_data_back(0) != 0;
+	s.pop_main();
+
+	state->cheat_data.verify_tick_stages = toggle_state;
+	return p + 2;
+}
+int32_t* f_tick_profile(fif::state_stack& s, int32_t* p, fif::environment* e) {
+	if(fif::typechecking_mode(e->mode)) {
+		if(fif::typechecking_failed(e->mode))
+			return p + 2;
+		s.pop_main();
+		return p + 2;
+	}
+
+	auto state_global = fif::get_global_var(*e, "state-ptr");
+	sys::state* state = (sys::state*)(state_global->data);
+
+	bool toggle_state = s.main_data_back(0) != 0;
+	s.pop_main();
+
+	if(toggle_state && !state->tick_profile.enabled.load(std::memory_order_relaxed))
+		state->tick_profile.reset();
+	state->tick_profile.enabled.store(toggle_state, std::memory_order_relaxed);
+	return p + 2;
+}
+int32_t* f_tick_profile_report(fif::state_stack& s, int32_t* p, fif::environment* e) {
+	if(fif::typechecking_mode(e->mode)) {
+		if(fif::typechecking_failed(e->mode))
+			return p + 2;
+		s.pop_main();
+		return p + 2;
+	}
+
+	auto state_global = fif::get_global_var(*e, "state-ptr");
+	sys::state* state = (sys::state*)(state_global->data);
+
+	auto days = int32_t(s.main_data_back(0));
+	s.pop_main();
+
+	auto summary = state->tick_profile.summarize(days);
+	if(summary.empty()) {
+		log_to_console(*state, state->ui_state.console_window, "No tick profile recorded (use: true tick-profile)");
+		return p + 2;
+	}
+	for(auto& phase : summary) {
+		auto average = phase.total_microseconds / std::max(phase.samples, 1);
+		log_to_console(*state, state->ui_state.console_window, std::string(phase.name) + ": " + std::to_string(phase.total_microseconds) + "us total, "
+			+ std::to_string(average) + "us avg, " + std::to_string(phase.max_microseconds) + "us max, " + std::to_string(phase.samples) + " runs, "
+			+ std::to_string(phase.max_workers) + " concurrent");
+	}
+	for(auto& counter : state->tick_profile.counter_totals()) {
+		log_to_console(*state, state->ui_state.console_window, std::string(counter.name) + ": " + std::to_string(counter.value) + " since the profile was started");
+	}
+	return p + 2;
+}
+int32_t* f_tick_profile_dump(fif::state_stack& s, int32_t* p, fif::environment* e) {
+	if(fif::typechecking_mode(e->mode)) {
+		if(fif::typechecking_failed(e->mode))
+			return p + 2;
+		return p + 2;
+	}
+
+	auto state_global = fif::get_global_var(*e, "state-ptr");
+	sys::state* state = (sys::state*)(state_global->data);
+
+	state->tick_profile.write_csv();
+	log_to_console(*state, state->ui_state.console_window, "Check \"My Documents\\Project Alice\\data_dumps\" for tick_profile.csv");
+	return p + 2;
+}
+int32_t* f_script_profile(fif::state_stack& s, int32_t* p, fif::environment* e) {
+	if(fif::typechecking_mode(e->mode)) {
+		if(fif::typechecking_failed(e->mode))
+			return p + 2;
+		s.pop_main();
+		return p + 2;
+	}
+
+	auto state_global = fif::get_global_var(*e, "state-ptr");
+	sys::state* state = (sys::state*)(state_global->data);
+
+	bool toggle_state = s.main_data_back(0) != 0;
+	s.pop_main();
+
+	if(toggle_state && !state->script_profile.enabled.load(std::memory_order_relaxed))
+		state->script_profile.reset(*state);
+	state->script_profile.enabled.store(toggle_state, std::memory_order_relaxed);
+	return p + 2;
+}
+int32_t* f_script_profile_report(fif::state_stack& s, int32_t* p, fif::environment* e) {
+	if(fif::typechecking_mode(e->mode)) {
+		if(fif::typechecking_failed(e->mode))
+			return p + 2;
+		s.pop_main();
+		return p + 2;
+	}
+
+	auto state_global = fif::get_global_var(*e, "state-ptr");
+	sys::state* state = (sys::state*)(state_global->data);
+
+	auto count = int32_t(s.main_data_back(0));
+	s.pop_main();
+
+	auto summary = state->script_profile.summarize(*state);
+	if(summary.empty()) {
+		log_to_console(*state, state->ui_state.console_window, "No script profile recorded (use: true script-profile)");
+		return p + 2;
+	}
+	for(int32_t i = 0; i < count && i < int32_t(summary.size()); ++i) {
+		auto& entry = summary[i];
+		auto kind = entry.kind == sys::script_kind::trigger ? "trigger " : (entry.kind == sys::script_kind::value_modifier ? "modifier " : "effect ");
+		log_to_console(*state, state->ui_state.console_window, std::string(kind) + std::to_string(entry.key_index) + ": "
+			+ std::to_string(entry.nanoseconds / 1000) + "us total, " + std::to_string(entry.calls) + " calls, " + std::to_string(entry.lanes) + " lanes ("
+			+ entry.source + ")");
+	}
+	return p + 2;
+}
+int32_t* f_script_profile_dump(fif::state_stack& s, int32_t* p, fif::environment* e) {
+	if(fif::typechecking_mode(e->mode)) {
+		if(fif::typechecking_failed(e->mode))
+			return p + 2;
+		return p + 2;
+	}
+
+	auto state_global = fif::get_global_var(*e, "state-ptr");
+	sys::state* state = (sys::state*)(state_global->data);
+
+	state->script_profile.write_csv(*state);
+	log_to_console(*state, state->ui_state.console_window, "Check \"My Documents\\Project Alice\\data_dumps\" for script_profile.csv");
+	return p + 2;
+}
+int32_t* f_jit_compare(fif::state_stack& s, int32_t* p, fif::environment* e) {
+	if(fif::typechecking_mode(e->mode)) {
+		if(fif::typechecking_failed(e->mode))
+			return p + 2;
+		s.pop_main();
+		return p + 2;
+	}
+
+	auto state_global = fif::get_global_var(*e, "state-ptr");
+	sys::state* state = (sys::state*)(state_global->data);
+
+	bool toggle_state = s.main_data_back(0) != 0;
+	s.pop_main();
+
+	if(toggle_state) {
+		if(!state->jit_compare_mode.load(std::memory_order_relaxed)) {
+			state->jit_comparisons.store(0, std::memory_order_relaxed);
+			state->jit_mismatches.store(0, std::memory_order_relaxed);
+		}
+		state->jit_compare_mode.store(true, std::memory_order_relaxed);
+	} else {
+		state->jit_compare_mode.store(false, std::memory_order_relaxed);
+		auto compared = state->jit_comparisons.load(std::memory_order_relaxed);
+		if(compared == 0) {
+			log_to_console(*state, state->ui_state.console_window, "No jit compiled modifier was evaluated (the jit is only used in single player builds with llvm)");
+		} else {
+			log_to_console(*state, state->ui_state.console_window, std::to_string(state->jit_mismatches.load(std::memory_order_relaxed)) + " of " + std::to_string(compared) + " jit results differed from the interpreter");
+		}
+	}
+	return p + 2;
+}
 int32_t* f_cheat_decision_potential(fif::state_stack& s, int32_t* p, fif::environment* e) {
 	if(fif::typechecking_mode(e->mode)) {
 		if(fif::typechecking_failed(e->mode))
@@ -1380,6 +1552,14 @@ void ui::initialize_console_fif_environment(sys::state& state) {
 	fif::add_import("cheat-navy", nullptr, f_cheat_navy, { fif::fif_bool }, {}, * state.fif_environment);
 	fif::add_import("cheat-factories", nullptr, f_cheat_factories, { fif::fif_bool }, {}, * state.fif_environment);
 	fif::add_import("daily-oos-check", nullptr, f_daily_oos, { fif::fif_bool }, {}, * state.fif_environment);
+	fif::add_import("verify-tick-stages", nullptr, f_verify_tick_stages, { fif::fif_bool }, {}, * state.fif_environment);
+	fif::add_import("tick-profile", nullptr, f_tick_profile, { fif::fif_bool }, {}, * state.fif_environment);
+	fif::add_import("tick-profile-report", nullptr, f_tick_profile_report, { fif::fif_i32 }, {}, * state.fif_environment);
+	fif::add_import("tick-profile-dump", nullptr, f_tick_profile_dump, {  }, {}, * state.fif_environment);
+	fif::add_import("script-profile", nullptr, f_script_profile, { fif::fif_bool }, {}, * state.fif_environment);
+	fif::add_import("script-profile-report", nullptr, f_script_profile_report, { fif::fif_i32 }, {}, * state.fif_environment);
+	fif::add_import("script-profile-dump", nullptr, f_script_profile_dump, {  }, {}, * state.fif_environment);
+	fif::add_import("jit-compare", nullptr, f_jit_compare, { fif::fif_bool }, {}, * state.fif_environment);
 	fif::add_import("set-auto-choice", nullptr, f_set_auto_choice, { fif::fif_bool }, {}, *state.fif_environment);
 	fif::add_import("complete-construction", nullptr, f_complete_construction, { nation_id_type }, {}, * state.fif_environment);
 	fif::add_import("instant-research", nullptr, f_instant_research, { nation_id_type, fif::fif_bool }, {}, * state.fif_environment);
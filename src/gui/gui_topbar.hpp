@@ -331,20 +331,20 @@ public:
 
 		text::substitution_map sub{};
 
-		auto total_income = economy::estimate_tax_income_by_strata(state, nation_id, culture::pop_strata::poor);
-		total_income += economy::estimate_tax_income_by_strata(state, nation_id, culture::pop_strata::middle);
-		total_income += economy::estimate_tax_income_by_strata(state, nation_id, culture::pop_strata::rich);
-		total_income += economy::estimate_gold_income(state, nation_id);
-
-		auto total_expense = economy::estimate_construction_spending(state, nation_id);
-		total_expense += economy::estimate_land_spending(state, nation_id);
-		total_expense += economy::estimate_naval_spending(state, nation_id);
-		total_expense += economy::estimate_social_spending(state, nation_id);
-		total_expense += economy::estimate_pop_payouts_by_income_type(state, nation_id, culture::income_type::education);
-		total_expense += economy::estimate_pop_payouts_by_income_type(state, nation_id, culture::income_type::administration);
-		total_expense += economy::estimate_pop_payouts_by_income_type(state, nation_id, culture::income_type::military);
+		auto total_income = economy::cached::estimate_tax_income_by_strata(state, nation_id, culture::pop_strata::poor);
+		total_income += economy::cached::estimate_tax_income_by_strata(state, nation_id, culture::pop_strata::middle);
+		total_income += economy::cached::estimate_tax_income_by_strata(state, nation_id, culture::pop_strata::rich);
+		total_income += economy::cached::estimate_gold_income(state, nation_id);
+
+		auto total_expense = economy::cached::estimate_construction_spending(state, nation_id);
+		total_expense += economy::cached::estimate_land_spending(state, nation_id);
+		total_expense += economy::cached::estimate_naval_spending(state, nation_id);
+		total_expense += economy::cached::estimate_social_spending(state, nation_id);
+		total_expense += economy::cached::estimate_pop_payouts_by_income_type(state, nation_id, culture::income_type::education);
+		total_expense += economy::cached::estimate_pop_payouts_by_income_type(state, nation_id, culture::income_type::administration);
+		total_expense += economy::cached::estimate_pop_payouts_by_income_type(state, nation_id, culture::income_type::military);
 		total_expense += economy::interest_payment(state, nation_id);
-		total_expense += economy::estimate_subsidy_spending(state, nation_id);
+		total_expense += economy::cached::estimate_subsidy_spending(state, nation_id);
 
 		text::add_to_substitution_map(sub, text::variable_type::yesterday,
 				text::fp_one_place{ nations::get_yesterday_income(state, nation_id) });
@@ -358,33 +358,33 @@ public:
 		text::add_line_break_to_layout(state, contents);
 
 		text::add_line(state, contents, std::string_view("budget_total_income"), text::variable_type::val, text::fp_three_places{ total_income }); // $VAL
-		text::add_line(state, contents, std::string_view("taxes_poor"), text::variable_type::val, text::fp_one_place{ economy::estimate_tax_income_by_strata(state, nation_id, culture::pop_strata::poor) }); // $VAL
+		text::add_line(state, contents, std::string_view("taxes_poor"), text::variable_type::val, text::fp_one_place{ economy::cached::estimate_tax_income_by_strata(state, nation_id, culture::pop_strata::poor) }); // $VAL
 		text::add_line(state, contents, std::string_view("taxes_middle"), text::variable_type::val,
-					text::fp_one_place{ economy::estimate_tax_income_by_strata(state, nation_id, culture::pop_strata::middle) }); // $VAL
+					text::fp_one_place{ economy::cached::estimate_tax_income_by_strata(state, nation_id, culture::pop_strata::middle) }); // $VAL
 		text::add_line(state, contents, std::string_view("taxes_rich"), text::variable_type::val,
-				text::fp_one_place{ economy::estimate_tax_income_by_strata(state, nation_id, culture::pop_strata::rich) }); // $VAL
+				text::fp_one_place{ economy::cached::estimate_tax_income_by_strata(state, nation_id, culture::pop_strata::rich) }); // $VAL
 		text::add_line(state, contents, std::string_view("tariffs_income"), text::variable_type::val,
 					text::fp_one_place{ economy::estimate_tariff_income(state, nation_id) }); // $VAL
 		text::add_line(state, contents, std::string_view("budget_exports")); // $VAL	TODO
-		text::add_line(state, contents, std::string_view("budget_gold"), text::variable_type::val, text::fp_one_place{ economy::estimate_gold_income(state, nation_id) }); // $VAL
+		text::add_line(state, contents, std::string_view("budget_gold"), text::variable_type::val, text::fp_one_place{ economy::cached::estimate_gold_income(state, nation_id) }); // $VAL
 		text::add_line(state, contents, std::string_view("budget_total_expense"), text::variable_type::val,
 					text::fp_three_places{ -total_expense }); // $VAL TODO
 		text::add_line(state, contents, std::string_view("budget_expense_slider_education"),
 					text::variable_type::val,
 					text::fp_three_places{
-							-economy::estimate_pop_payouts_by_income_type(state, nation_id, culture::income_type::education) }); // $VAL
+							-economy::cached::estimate_pop_payouts_by_income_type(state, nation_id, culture::income_type::education) }); // $VAL
 		text::add_line(state, contents, std::string_view("budget_slider_administration"),
 					text::variable_type::val,
 					text::fp_three_places{
-							-economy::estimate_pop_payouts_by_income_type(state, nation_id, culture::income_type::administration) }); // $VAL
+							-economy::cached::estimate_pop_payouts_by_income_type(state, nation_id, culture::income_type::administration) }); // $VAL
 		text::add_line(state, contents, std::string_view("budget_slider_social_spending"),
 					text::variable_type::val,
 					text::fp_three_places{
-							-economy::estimate_social_spending(state, nation_id) }); // $VAL - presumably loan payments == interest (?)
+							-economy::cached::estimate_social_spending(state, nation_id) }); // $VAL - presumably loan payments == interest (?)
 		text::add_line(state, contents, std::string_view("budget_slider_military_spending"),
 				text::variable_type::val,
 				text::fp_two_places{
-						-economy::estimate_pop_payouts_by_income_type(state, nation_id, culture::income_type::military) }); // $VAL
+						-economy::cached::estimate_pop_payouts_by_income_type(state, nation_id, culture::income_type::military) }); // $VAL
 		text::add_line(state, contents, std::string_view("budget_interest"), text::variable_type::val,
 				text::fp_one_place{
 						-economy::interest_payment(state, nation_id) }); // $VAL - presumably loan payments == interest (?)
@@ -395,7 +395,7 @@ public:
 		text::add_line_break_to_layout(state, contents);
 
 		text::add_line(state, contents, std::string_view("topbar_projected_income"), text::variable_type::val,
-				text::fp_two_places{ economy::estimate_daily_income(state, nation_id) });
+				text::fp_two_places{ economy::cached::estimate_daily_income(state, nation_id) });
 
 		*/
 
@@ -424,7 +424,7 @@ public:
 					auto constructions = economy::estimate_private_investment_construct(state, n, false);
 					auto province_constr = economy::estimate_private_investment_province(state, n);
 
-					if(economy::estimate_private_construction_spendings(state, n) < 1.0f && upgrades.size() == 0 && constructions.size() == 0 && province_constr.size() == 0) {
+					if(economy::cached::estimate_private_construction_spendings(state, n) < 1.0f && upgrades.size() == 0 && constructions.size() == 0 && province_constr.size() == 0) {
 						auto amt = state.world.nation_get_private_investment(n) * state.defines.alice_privateinvestment_subject_transfer / 100.f;
 
 						text::substitution_map sub{};
@@ -445,7 +445,7 @@ public:
 			text::close_layout_box(contents, box);
 		}
 
-		auto private_constr = economy::estimate_private_construction_spendings(state, state.local_player_nation);
+		auto private_constr = economy::cached::estimate_private_construction_spendings(state, state.local_player_nation);
 		{
 			text::substitution_map sub{};
 			text::add_to_substitution_map(sub, text::variable_type::x, text::fp_currency{ private_constr });
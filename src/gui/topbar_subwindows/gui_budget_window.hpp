@@ -70,7 +70,7 @@ namespace ui {
 class nation_gold_income_text : public simple_text_element_base {
 public:
 	void on_update(sys::state& state) noexcept override {
-		set_text(state, text::format_money(economy::estimate_gold_income(state, state.local_player_nation)));
+		set_text(state, text::format_money(economy::cached::estimate_gold_income(state, state.local_player_nation)));
 	}
 };
 
@@ -84,7 +84,7 @@ public:
 class nation_diplomatic_balance_text : public simple_text_element_base {
 public:
 	void on_update(sys::state& state) noexcept override {
-		set_text(state, text::format_money(economy::estimate_diplomatic_balance(state, state.local_player_nation)));
+		set_text(state, text::format_money(economy::cached::estimate_diplomatic_balance(state, state.local_player_nation)));
 	}
 	tooltip_behavior has_tooltip(sys::state& state) noexcept override {
 		return tooltip_behavior::variable_tooltip;
@@ -93,8 +93,8 @@ public:
 		auto n = retrieve<dcon::nation_id>(state, parent);
 
 		float w_subsidies_amount =
-			economy::estimate_war_subsidies_income(state, n) - economy::estimate_war_subsidies_spending(state, n);
-		float reparations_amount = economy::estimate_reparations_income(state, n) - economy::estimate_reparations_spending(state, n);
+			economy::cached::estimate_war_subsidies_income(state, n) - economy::cached::estimate_war_subsidies_spending(state, n);
+		float reparations_amount = economy::cached::estimate_reparations_income(state, n) - economy::cached::estimate_reparations_spending(state, n);
 
 		if(w_subsidies_amount > 0.0f) {
 			text::substitution_map m;
@@ -124,8 +124,8 @@ public:
 			text::close_layout_box(contents, box);
 		}
 
-		auto subjectpayments_income = economy::estimate_subject_payments_received(state, n);
-		auto subjectpayments_expense = economy::estimate_subject_payments_paid(state, n);
+		auto subjectpayments_income = economy::cached::estimate_subject_payments_received(state, n);
+		auto subjectpayments_expense = economy::cached::estimate_subject_payments_paid(state, n);
 
 		if(subjectpayments_income != 0.0f) {
 			{
@@ -141,7 +141,7 @@ public:
 				auto overlord = state.world.overlord_get_ruler(rel);
 
 				if(overlord == n) {
-					auto paid = economy::estimate_subject_payments_paid(state, on);
+					auto paid = economy::cached::estimate_subject_payments_paid(state, on);
 
 					text::substitution_map m;
 					text::add_to_substitution_map(m, text::variable_type::val, text::fp_one_place{ paid });
@@ -166,7 +166,7 @@ public:
 class nation_subsidy_spending_text : public simple_text_element_base {
 public:
 	void on_update(sys::state& state) noexcept override {
-		set_text(state, text::format_money(economy::estimate_subsidy_spending(state, state.local_player_nation)));
+		set_text(state, text::format_money(economy::cached::estimate_subsidy_spending(state, state.local_player_nation)));
 	}
 };
 
@@ -1343,7 +1343,7 @@ class budget_actual_stockpile_spending_text : public budget_scaled_monetary_valu
 public:
 	void put_values(sys::state& state, std::array<float, size_t(budget_slider_target::target_count)>& vals) noexcept override {
 		vals[uint8_t(budget_slider_target::stockpile_filling)] =
-			economy::estimate_stockpile_filling_spending(state, state.local_player_nation);
+			economy::cached::estimate_stockpile_filling_spending(state, state.local_player_nation);
 	}
 };
 
@@ -1351,17 +1351,17 @@ class budget_estimated_stockpile_spending_text : public budget_scaled_monetary_v
 public:
 	void put_values(sys::state& state, std::array<float, size_t(budget_slider_target::target_count)>& vals) noexcept override {
 		vals[uint8_t(budget_slider_target::construction_stock)] =
-				economy::estimate_construction_spending(state, state.local_player_nation);
-		vals[uint8_t(budget_slider_target::army_stock)] = economy::estimate_land_spending(state, state.local_player_nation);
-		vals[uint8_t(budget_slider_target::navy_stock)] = economy::estimate_naval_spending(state, state.local_player_nation);
+				economy::cached::estimate_construction_spending(state, state.local_player_nation);
+		vals[uint8_t(budget_slider_target::army_stock)] = economy::cached::estimate_land_spending(state, state.local_player_nation);
+		vals[uint8_t(budget_slider_target::navy_stock)] = economy::cached::estimate_naval_spending(state, state.local_player_nation);
 	}
 };
 
 class budget_military_spending_text : public budget_scaled_monetary_value_text {
 public:
 	void put_values(sys::state& state, std::array<float, size_t(budget_slider_target::target_count)>& vals) noexcept override {
-		vals[uint8_t(budget_slider_target::army_stock)] = economy::estimate_land_spending(state, state.local_player_nation);
-		vals[uint8_t(budget_slider_target::navy_stock)] = economy::estimate_naval_spending(state, state.local_player_nation);
+		vals[uint8_t(budget_slider_target::army_stock)] = economy::cached::estimate_land_spending(state, state.local_player_nation);
+		vals[uint8_t(budget_slider_target::navy_stock)] = economy::cached::estimate_naval_spending(state, state.local_player_nation);
 	}
 };
 
@@ -1369,21 +1369,21 @@ class budget_overseas_spending_text : public budget_scaled_monetary_value_text {
 public:
 	void put_values(sys::state& state, std::array<float, size_t(budget_slider_target::target_count)>& vals) noexcept override {
 		vals[uint8_t(budget_slider_target::overseas)] =
-			economy::estimate_overseas_penalty_spending(state, state.local_player_nation);
+			economy::cached::estimate_overseas_penalty_spending(state, state.local_player_nation);
 	}
 };
 
 class budget_tariff_income_text : public budget_scaled_monetary_value_text {
 public:
 	void put_values(sys::state& state, std::array<float, size_t(budget_slider_target::target_count)>& vals) noexcept override {
-		vals[uint8_t(budget_slider_target::tariffs)] = economy::estimate_tariff_import_income(state, state.local_player_nation);
+		vals[uint8_t(budget_slider_target::tariffs)] = economy::cached::estimate_tariff_import_income(state, state.local_player_nation);
 	}
 };
 
 template<culture::pop_strata Strata, budget_slider_target BudgetTarget>
 class budget_stratified_tax_income_text : public budget_scaled_monetary_value_text {
 	void put_values(sys::state& state, std::array<float, size_t(budget_slider_target::target_count)>& vals) noexcept override {
-		vals[uint8_t(BudgetTarget)] = economy::estimate_tax_income_by_strata(state, state.local_player_nation, Strata);
+		vals[uint8_t(BudgetTarget)] = economy::cached::estimate_tax_income_by_strata(state, state.local_player_nation, Strata);
 	}
 };
 
@@ -1391,14 +1391,14 @@ template<culture::income_type IncomeType, budget_slider_target BudgetTarget>
 class budget_expenditure_text : public budget_scaled_monetary_value_text {
 public:
 	void put_values(sys::state& state, std::array<float, size_t(budget_slider_target::target_count)>& vals) noexcept override {
-		vals[uint8_t(BudgetTarget)] = economy::estimate_pop_payouts_by_income_type(state, state.local_player_nation, IncomeType);
+		vals[uint8_t(BudgetTarget)] = economy::cached::estimate_pop_payouts_by_income_type(state, state.local_player_nation, IncomeType);
 	}
 };
 
 class budget_social_spending_text : public budget_scaled_monetary_value_text {
 public:
 	void put_values(sys::state& state, std::array<float, size_t(budget_slider_target::target_count)>& vals) noexcept override {
-		vals[uint8_t(budget_slider_target::social)] = economy::estimate_social_spending(state, state.local_player_nation);
+		vals[uint8_t(budget_slider_target::social)] = economy::cached::estimate_social_spending(state, state.local_player_nation);
 	}
 };
 
@@ -1406,12 +1406,12 @@ class budget_income_projection_text : public budget_scaled_monetary_value_text {
 public:
 	void put_values(sys::state& state, std::array<float, size_t(budget_slider_target::target_count)>& vals) noexcept override {
 		vals[uint8_t(budget_slider_target::poor_tax)] =
-				economy::estimate_tax_income_by_strata(state, state.local_player_nation, culture::pop_strata::poor);
+				economy::cached::estimate_tax_income_by_strata(state, state.local_player_nation, culture::pop_strata::poor);
 		vals[uint8_t(budget_slider_target::middle_tax)] =
-				economy::estimate_tax_income_by_strata(state, state.local_player_nation, culture::pop_strata::middle);
+				economy::cached::estimate_tax_income_by_strata(state, state.local_player_nation, culture::pop_strata::middle);
 		vals[uint8_t(budget_slider_target::rich_tax)] =
-				economy::estimate_tax_income_by_strata(state, state.local_player_nation, culture::pop_strata::rich);
-		vals[uint8_t(budget_slider_target::gold_income)] = economy::estimate_gold_income(state, state.local_player_nation);
+				economy::cached::estimate_tax_income_by_strata(state, state.local_player_nation, culture::pop_strata::rich);
+		vals[uint8_t(budget_slider_target::gold_income)] = economy::cached::estimate_gold_income(state, state.local_player_nation);
 	}
 };
 
@@ -1419,20 +1419,20 @@ class budget_expenditure_projection_text : public budget_scaled_monetary_value_t
 public:
 	void put_values(sys::state& state, std::array<float, size_t(budget_slider_target::target_count)>& vals) noexcept override {
 		vals[uint8_t(budget_slider_target::construction_stock)] =
-				economy::estimate_construction_spending(state, state.local_player_nation);
-		vals[uint8_t(budget_slider_target::army_stock)] = economy::estimate_land_spending(state, state.local_player_nation);
-		vals[uint8_t(budget_slider_target::navy_stock)] = economy::estimate_naval_spending(state, state.local_player_nation);
-		vals[uint8_t(budget_slider_target::social)] = economy::estimate_social_spending(state, state.local_player_nation);
+				economy::cached::estimate_construction_spending(state, state.local_player_nation);
+		vals[uint8_t(budget_slider_target::army_stock)] = economy::cached::estimate_land_spending(state, state.local_player_nation);
+		vals[uint8_t(budget_slider_target::navy_stock)] = economy::cached::estimate_naval_spending(state, state.local_player_nation);
+		vals[uint8_t(budget_slider_target::social)] = economy::cached::estimate_social_spending(state, state.local_player_nation);
 		vals[uint8_t(budget_slider_target::education)] =
-			economy::estimate_pop_payouts_by_income_type(state, state.local_player_nation, culture::income_type::education);
+			economy::cached::estimate_pop_payouts_by_income_type(state, state.local_player_nation, culture::income_type::education);
 		vals[uint8_t(budget_slider_target::admin)] =
-			economy::estimate_pop_payouts_by_income_type(state, state.local_player_nation, culture::income_type::administration);
+			economy::cached::estimate_pop_payouts_by_income_type(state, state.local_player_nation, culture::income_type::administration);
 		vals[uint8_t(budget_slider_target::military)] =
-			economy::estimate_pop_payouts_by_income_type(state, state.local_player_nation, culture::income_type::military);
-		vals[uint8_t(budget_slider_target::domestic_investment)] = economy::estimate_domestic_investment(state, state.local_player_nation);
-		vals[uint8_t(budget_slider_target::subsidies)] = economy::estimate_subsidy_spending(state, state.local_player_nation);
-		vals[uint8_t(budget_slider_target::overseas)] = economy::estimate_overseas_penalty_spending(state, state.local_player_nation);
-		vals[uint8_t(budget_slider_target::stockpile_filling)] = economy::estimate_stockpile_filling_spending(state, state.local_player_nation);
+			economy::cached::estimate_pop_payouts_by_income_type(state, state.local_player_nation, culture::income_type::military);
+		vals[uint8_t(budget_slider_target::domestic_investment)] = economy::cached::estimate_domestic_investment(state, state.local_player_nation);
+		vals[uint8_t(budget_slider_target::subsidies)] = economy::cached::estimate_subsidy_spending(state, state.local_player_nation);
+		vals[uint8_t(budget_slider_target::overseas)] = economy::cached::estimate_overseas_penalty_spending(state, state.local_player_nation);
+		vals[uint8_t(budget_slider_target::stockpile_filling)] = economy::cached::estimate_stockpile_filling_spending(state, state.local_player_nation);
 		vals[uint8_t(budget_slider_target::interest)] = economy::interest_payment(state, state.local_player_nation);
 	}
 };
@@ -1442,30 +1442,30 @@ public:
 	void put_values(sys::state& state, std::array<float, size_t(budget_slider_target::target_count)>& vals) noexcept override {
 		// income
 		vals[uint8_t(budget_slider_target::poor_tax)] =
-				economy::estimate_tax_income_by_strata(state, state.local_player_nation, culture::pop_strata::poor);
+				economy::cached::estimate_tax_income_by_strata(state, state.local_player_nation, culture::pop_strata::poor);
 		vals[uint8_t(budget_slider_target::middle_tax)] =
-				economy::estimate_tax_income_by_strata(state, state.local_player_nation, culture::pop_strata::middle);
+				economy::cached::estimate_tax_income_by_strata(state, state.local_player_nation, culture::pop_strata::middle);
 		vals[uint8_t(budget_slider_target::rich_tax)] =
-				economy::estimate_tax_income_by_strata(state, state.local_player_nation, culture::pop_strata::rich);
-		vals[uint8_t(budget_slider_target::gold_income)] = economy::estimate_gold_income(state, state.local_player_nation);
+				economy::cached::estimate_tax_income_by_strata(state, state.local_player_nation, culture::pop_strata::rich);
+		vals[uint8_t(budget_slider_target::gold_income)] = economy::cached::estimate_gold_income(state, state.local_player_nation);
 
 		// spend
 		vals[uint8_t(budget_slider_target::construction_stock)] =
-				-economy::estimate_construction_spending(state, state.local_player_nation);
-		vals[uint8_t(budget_slider_target::army_stock)] = -economy::estimate_land_spending(state, state.local_player_nation);
-		vals[uint8_t(budget_slider_target::navy_stock)] = -economy::estimate_naval_spending(state, state.local_player_nation);
-		vals[uint8_t(budget_slider_target::social)] = -economy::estimate_social_spending(state, state.local_player_nation);
-		vals[uint8_t(budget_slider_target::education)] = -economy::estimate_pop_payouts_by_income_type(state, state.local_player_nation, culture::income_type::education);
-		vals[uint8_t(budget_slider_target::admin)] = -economy::estimate_pop_payouts_by_income_type(state, state.local_player_nation, culture::income_type::administration);
-		vals[uint8_t(budget_slider_target::military)] = -economy::estimate_pop_payouts_by_income_type(state, state.local_player_nation, culture::income_type::military);
-		vals[uint8_t(budget_slider_target::subsidies)] = -economy::estimate_subsidy_spending(state, state.local_player_nation);
-		vals[uint8_t(budget_slider_target::overseas)] = -economy::estimate_overseas_penalty_spending(state, state.local_player_nation);
-		vals[uint8_t(budget_slider_target::stockpile_filling)] = -economy::estimate_stockpile_filling_spending(state, state.local_player_nation);
-		vals[uint8_t(budget_slider_target::domestic_investment)] = -economy::estimate_domestic_investment(state, state.local_player_nation);
+				-economy::cached::estimate_construction_spending(state, state.local_player_nation);
+		vals[uint8_t(budget_slider_target::army_stock)] = -economy::cached::estimate_land_spending(state, state.local_player_nation);
+		vals[uint8_t(budget_slider_target::navy_stock)] = -economy::cached::estimate_naval_spending(state, state.local_player_nation);
+		vals[uint8_t(budget_slider_target::social)] = -economy::cached::estimate_social_spending(state, state.local_player_nation);
+		vals[uint8_t(budget_slider_target::education)] = -economy::cached::estimate_pop_payouts_by_income_type(state, state.local_player_nation, culture::income_type::education);
+		vals[uint8_t(budget_slider_target::admin)] = -economy::cached::estimate_pop_payouts_by_income_type(state, state.local_player_nation, culture::income_type::administration);
+		vals[uint8_t(budget_slider_target::military)] = -economy::cached::estimate_pop_payouts_by_income_type(state, state.local_player_nation, culture::income_type::military);
+		vals[uint8_t(budget_slider_target::subsidies)] = -economy::cached::estimate_subsidy_spending(state, state.local_player_nation);
+		vals[uint8_t(budget_slider_target::overseas)] = -economy::cached::estimate_overseas_penalty_spending(state, state.local_player_nation);
+		vals[uint8_t(budget_slider_target::stockpile_filling)] = -economy::cached::estimate_stockpile_filling_spending(state, state.local_player_nation);
+		vals[uint8_t(budget_slider_target::domestic_investment)] = -economy::cached::estimate_domestic_investment(state, state.local_player_nation);
 		// balance
-		vals[uint8_t(budget_slider_target::diplomatic_interest)] = economy::estimate_diplomatic_balance(state, state.local_player_nation);
+		vals[uint8_t(budget_slider_target::diplomatic_interest)] = economy::cached::estimate_diplomatic_balance(state, state.local_player_nation);
 		vals[uint8_t(budget_slider_target::interest)] = -economy::interest_payment(state, state.local_player_nation);
-		vals[uint8_t(budget_slider_target::tariffs)] = economy::estimate_tariff_import_income(state, state.local_player_nation);
+		vals[uint8_t(budget_slider_target::tariffs)] = economy::cached::estimate_tariff_import_income(state, state.local_player_nation);
 	}
 };
 
@@ -1906,7 +1906,7 @@ class domestic_investment_estimated_text : public simple_text_element_base {
 public:
 	void on_update(sys::state& state) noexcept override {
 		float value = state.world.nation_get_domestic_investment_spending(state.local_player_nation) / 100.0f;
-		set_text(state, text::format_money(economy::estimate_domestic_investment(state, state.local_player_nation) * value * value));
+		set_text(state, text::format_money(economy::cached::estimate_domestic_investment(state, state.local_player_nation) * value * value));
 	}
 };
 
@@ -1930,7 +1930,7 @@ class overseas_maintenance_estimated_text : public simple_text_element_base {
 public:
 	void on_update(sys::state& state) noexcept override {
 		float value = state.world.nation_get_overseas_spending(state.local_player_nation) / 100.0f;
-		set_text(state, text::format_money(economy::estimate_overseas_penalty_spending(state, state.local_player_nation) * value));
+		set_text(state, text::format_money(economy::cached::estimate_overseas_penalty_spending(state, state.local_player_nation) * value));
 	}
 };
 
@@ -12,6 +12,9 @@
 #include "texture.cpp"
 #include "date_interface.cpp"
 #include "serialization.cpp"
+#include "tick_scheduler.cpp"
+#include "tick_profiler.cpp"
+#include "script_profiler.cpp"
 #include "nations.cpp"
 #include "culture.cpp"
 #include "military.cpp"
@@ -2330,12 +2330,14 @@ void give_military_access(sys::state& state, dcon::nation_id accessing_nation, d
 		ur = state.world.force_create_unilateral_relationship(target, accessing_nation);
 	}
 	state.world.unilateral_relationship_set_military_access(ur, true);
+	province::invalidate_path_cache(state, accessing_nation);
 }
 void remove_military_access(sys::state& state, dcon::nation_id accessing_nation, dcon::nation_id target) {
 	auto ur = state.world.get_unilateral_relationship_by_unilateral_pair(target, accessing_nation);
 	if(ur) {
 		state.world.unilateral_relationship_set_military_access(ur, false);
 	}
+	province::invalidate_path_cache(state, accessing_nation);
 }
 
 void end_wars_between(sys::state& state, dcon::nation_id a, dcon::nation_id b) {
@@ -2363,6 +2365,14 @@ void populate_war_text_subsitutions(sys::state& state, dcon::war_id w, text::sub
 	text::add_to_substitution_map(sub, text::variable_type::country_adj, state.world.national_identity_get_adjective(war.get_over_tag()));
 }
 
+// joining or leaving a war changes which provinces every participant may enter
+static void invalidate_war_paths(sys::state& state, dcon::war_id w, dcon::nation_id n) {
+	province::invalidate_path_cache(state, n);
+	for(auto p : state.world.war_get_war_participant(w)) {
+		province::invalidate_path_cache(state, p.get_nation());
+	}
+}
+
 void add_to_war(sys::state& state, dcon::war_id w, dcon::nation_id n, bool as_attacker, bool on_war_creation) {
 	assert(n);
 	if(state.world.nation_get_owned_province_count(n) == 0)
@@ -2370,6 +2380,7 @@ void add_to_war(sys::state& state, dcon::war_id w, dcon::nation_id n, bool as_at
 
 	auto participant = state.world.force_create_war_participant(w, n);
 	state.world.war_participant_set_is_attacker(participant, as_attacker);
+	invalidate_war_paths(state, w, n);
 	state.world.nation_set_is_at_war(n, true);
 	state.world.nation_set_disarmed_until(n, sys::date{});
 
@@ -2758,6 +2769,7 @@ void remove_from_war(sys::state& state, dcon::war_id w, dcon::nation_id n, bool
 	for(auto vas : state.world.nation_get_overlord_as_ruler(n)) {
 		remove_from_war(state, w, vas.get_subject(), as_loss);
 	}
+	invalidate_war_paths(state, w, n);
 
 	dcon::war_participant_id par;
 	for(auto p : state.world.nation_get_war_participant(n)) {
@@ -2905,6 +2917,7 @@ void take_from_sphere(sys::state& state, dcon::nation_id member, dcon::nation_id
 		state.world.gp_relationship_get_status(rel) &= ~nations::influence::level_mask;
 		state.world.gp_relationship_get_status(rel) |= nations::influence::level_hostile;
 		state.world.nation_set_in_sphere_of(member, dcon::nation_id{});
+		province::invalidate_path_cache(state, existing_sphere_leader);
 	}
 
 	if(!nations::is_great_power(state, new_gp))
@@ -2921,6 +2934,7 @@ void take_from_sphere(sys::state& state, dcon::nation_id member, dcon::nation_id
 	state.world.gp_relationship_get_status(nrel) |= nations::influence::level_in_sphere;
 	state.world.gp_relationship_set_influence(nrel, state.defines.max_influence);
 	state.world.nation_set_in_sphere_of(member, new_gp);
+	province::invalidate_path_cache(state, new_gp);
 
 	notification::post(state, notification::message{
 		[member, existing_sphere_leader, new_gp](sys::state& state, text::layout_base& contents) {
@@ -3162,6 +3176,7 @@ void implement_war_goal(sys::state& state, dcon::war_id war, dcon::cb_type_id wa
 			auto& flags = state.world.gp_relationship_get_status(sr);
 			flags = uint8_t((flags & ~nations::influence::level_mask) | nations::influence::level_in_sphere);
 			state.world.nation_set_in_sphere_of(holder, from);
+			province::invalidate_path_cache(state, from);
 		}
 		add_truce(state, holder, target, int32_t(state.defines.base_truce_months) * 30);
 
@@ -3261,6 +3276,7 @@ void implement_war_goal(sys::state& state, dcon::war_id war, dcon::cb_type_id wa
 
 			if(overlord == target) {
 				state.world.overlord_set_ruler(rel, from);
+				province::invalidate_path_cache(state, from);
 			}
 		}
 
@@ -5551,6 +5567,7 @@ void apply_regiment_damage(sys::state& state) {
 						(3.0f * (1.0f + state.world.nation_get_modifier_values(tech_nation,
 							sys::national_mod_offsets::soldier_to_pop_loss)));
 					if(psize <= 1.0f) {
+						demographics::remove_pop_contribution(state, backing_pop);
 						state.world.delete_pop(backing_pop);
 					}
 				}
@@ -6867,11 +6884,23 @@ void send_rebel_hunter_to_next_province(sys::state& state, dcon::army_id ar, dco
 	rebel::get_hunting_targets(state, controller, rebel_provs);
 	rebel::sort_hunting_targets(state, rebel::impl::arm_str{ ar, ai::estimate_army_offensive_strength(state, ar) }, rebel_provs);
 
+	// one search from the army finds the paths to all of the targets, instead of one search per target tried
+	static thread_local std::vector<dcon::province_id> target_provs;
+	static thread_local province::distance_field hunting_distances;
+	static thread_local std::vector<dcon::province_id> path;
+	target_provs.clear();
+	for(auto& next_prov : rebel_provs) {
+		if(prov != next_prov.p)
+			target_provs.push_back(next_prov.p);
+	}
+	if(!target_provs.empty())
+		province::find_land_distances(state, prov, controller, a, target_provs, 0, std::numeric_limits<float>::infinity(), hunting_distances);
+
 	for(auto& next_prov : rebel_provs) {
 		if(prov == next_prov.p)
 			continue;
 
-		auto path = province::make_land_path(state, prov, next_prov.p, controller, a);
+		hunting_distances.path_to(next_prov.p, path);
 		if(path.size() > 0) {
 			auto existing_path = state.world.army_get_path(a);
 
@@ -6893,7 +6922,7 @@ void send_rebel_hunter_to_next_province(sys::state& state, dcon::army_id ar, dco
 		if(home == prov)
 			return;
 
-		auto path = province::make_land_path(state, prov, home, controller, a);
+		province::make_land_path(state, prov, home, controller, a, path);
 		if(path.size() > 0) {
 			auto existing_path = state.world.army_get_path(a);
 
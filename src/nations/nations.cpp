@@ -159,7 +159,132 @@ void restore_unsaved_values(sys::state& state) {
 	restore_cached_values(state);
 }
 
-void recalculate_markets_distance(sys::state& state) {
+namespace {
+
+enum class trade_path_kind : uint8_t { sea, land };
+
+// effective distance of one step of a sea route, as charged to traders
+float sea_step_distance(sys::state& state, float distance, dcon::province_id p_prev, dcon::province_id p_current) {
+	float sum_mods =
+		state.world.province_get_modifier_values(p_current, sys::provincial_mod_offsets::movement_cost)
+		+ state.world.province_get_modifier_values(p_prev, sys::provincial_mod_offsets::movement_cost);
+	return std::max(0.01f, distance * std::max(0.01f, (sum_mods * 2.f + 1.0f)));
+}
+
+// effective distance of one step of a land route, as charged to traders
+float land_step_distance(sys::state& state, float distance, dcon::province_id p_prev, dcon::province_id p_current) {
+	float sum_mods =
+		state.world.province_get_modifier_values(p_current, sys::provincial_mod_offsets::movement_cost)
+		+ state.world.province_get_modifier_values(p_prev, sys::provincial_mod_offsets::movement_cost);
+	float local_effective_distance = distance * std::max(0.01f, sum_mods * 3.f);
+	auto railroad_origin = state.world.province_get_building_level(p_prev, uint8_t(economy::province_building_type::railroad));
+	auto railroad_target = state.world.province_get_building_level(p_current, uint8_t(economy::province_building_type::railroad));
+	if(railroad_origin > 0 && railroad_target > 0) {
+		local_effective_distance = local_effective_distance / 2.f;
+	}
+	local_effective_distance -= 0.03f * std::min(railroad_target, railroad_origin) * local_effective_distance;
+	return std::max(0.01f, local_effective_distance);
+}
+
+//
+// Finds the effective trade distance from one province to every province of targets with a single shortest path search. Paths
+// are chosen by the same step costs as make_naval_path (sea) and make_unowned_path (land), and the effective distance is summed
+// along them. Unlike those searches, which keep the first way they find to each province, this one finds the shortest path by
+// those costs, so a route may be measured along a different path than before. The search stops as soon as every target has been
+// reached. A target that cannot be reached, or that is the start itself, gets the distance of an empty path (zero), as the point
+// to point pathfinding reported it. The buffers are kept per thread and, like the province pathfinding, stamped per search
+//
+void find_trade_distances(sys::state& state, trade_path_kind kind, dcon::province_id start, std::vector<dcon::province_id> const& targets, std::vector<float>& result) {
+	result.assign(targets.size(), 0.f);
+	if(!start || targets.empty())
+		return;
+
+	static thread_local province::distance_field field;
+	static thread_local std::vector<float> effective_distance; // only read for provinces seen by the current search
+
+	auto remaining = field.begin_search(state, start, targets);
+	auto const generation = field.generation;
+	if(effective_distance.size() != field.distances.size())
+		effective_distance.resize(field.distances.size(), 0.f);
+	effective_distance[start.index()] = 0.f;
+	if(field.target_stamps[start.index()] == generation)
+		--remaining;
+
+	auto first_sea = state.province_definitions.first_sea_province.index();
+
+	while(field.heap.size() > 0 && remaining > 0) {
+		std::pop_heap(field.heap.begin(), field.heap.end());
+		auto nearest = field.heap.back();
+		field.heap.pop_back();
+
+		auto p = nearest.province;
+		if(field.settled_stamps[p.index()] == generation)
+			continue;
+		field.settled_stamps[p.index()] = generation;
+		if(p != start && field.target_stamps[p.index()] == generation)
+			--remaining;
+
+		bool p_is_sea = p.index() >= first_sea;
+		// fleets only pass through land provinces when leaving the starting port
+		if(kind == trade_path_kind::sea && !p_is_sea && p != start)
+			continue;
+
+		auto railroad_origin = state.world.province_get_building_level(p, uint8_t(economy::province_building_type::railroad));
+
+		for(auto adj : state.world.province_get_province_adjacency(p)) {
+			auto bits = adj.get_type();
+			if((bits & province::border::impassible_bit) != 0)
+				continue;
+			auto other = adj.get_connected_provinces(0) == p ? adj.get_connected_provinces(1) : adj.get_connected_provinces(0);
+			if(field.settled_stamps[other.id.index()] == generation)
+				continue;
+
+			auto distance = adj.get_distance();
+			float step = distance;
+			float effective_step = 0.f;
+			if(kind == trade_path_kind::sea) {
+				bool other_is_sea = other.id.index() >= first_sea;
+				if(!p_is_sea) {
+					// leaving port
+					if(state.world.province_get_port_to(p) != other.id)
+						continue;
+				} else if(!other_is_sea) {
+					// ending in a port
+					if((bits & province::border::coastal_bit) == 0 || other.get_port_to() != p || field.target_stamps[other.id.index()] != generation)
+						continue;
+				} else if((bits & province::border::coastal_bit) != 0) {
+					continue;
+				}
+				effective_step = sea_step_distance(state, distance, p, other);
+			} else {
+				auto railroad_target = state.world.province_get_building_level(other, uint8_t(economy::province_building_type::railroad));
+				if(railroad_origin > 0 && railroad_target > 0) {
+					step = step / 2.f;
+				}
+				step -= 0.03f * std::min(railroad_target, railroad_origin) * step;
+				effective_step = land_step_distance(state, distance, p, other);
+			}
+
+			auto candidate = nearest.distance + step;
+			if(field.seen_stamps[other.id.index()] != generation || candidate < field.distances[other.id.index()]) {
+				field.seen_stamps[other.id.index()] = generation;
+				field.distances[other.id.index()] = candidate;
+				field.parents[other.id.index()] = p;
+				effective_distance[other.id.index()] = effective_distance[p.index()] + effective_step;
+				field.heap.push_back(province::distance_field_entry{ candidate, other });
+				std::push_heap(field.heap.begin(), field.heap.end());
+			}
+		}
+	}
+
+	for(uint32_t i = 0; i < targets.size(); ++i) {
+		auto t = targets[i];
+		if(t && t != start && field.reached(t))
+			result[i] = effective_distance[t.index()];
+	}
+}
+
+float trade_transport_speed(sys::state& state) {
 	float total_transport_speed = 0.f;
 	float total_amount_of_transports = 0.f;
 
@@ -171,7 +296,13 @@ void recalculate_markets_distance(sys::state& state) {
 		}
 	}
 
-	auto base_speed = total_transport_speed / total_amount_of_transports;
+	return total_transport_speed / total_amount_of_transports;
+}
+
+} // namespace
+
+void recalculate_markets_distance(sys::state& state) {
+	auto base_speed = trade_transport_speed(state);
 	
 	state.world.execute_parallel_over_market([&](auto markets) {
 		auto sids = state.world.market_get_zone_from_local_market(markets);
@@ -194,88 +325,48 @@ void recalculate_markets_distance(sys::state& state) {
 		state.world.market_set_max_throughput(markets, throughput);
 	});
 
-	state.world.execute_parallel_over_trade_route([&](auto routes) {
-		// recalculate effective distance
-		auto markets_0 = ve::apply([&](auto route) { return state.world.trade_route_get_connected_markets(route, 0); }, routes);
-		auto markets_1 = ve::apply([&](auto route) { return state.world.trade_route_get_connected_markets(route, 1); }, routes);
-
-		auto sids_0 = state.world.market_get_zone_from_local_market(markets_0);
-		auto sids_1 = state.world.market_get_zone_from_local_market(markets_1);
-
-		ve::apply([&](auto sid_0, auto sid_1, auto route) {
-			if (state.world.trade_route_get_is_sea_route(route)) {
-				std::vector<dcon::province_id> path{ };
-				auto speed = base_speed;
-				dcon::province_id p_prev{ };
-
-				auto coast_0 = province::state_get_coastal_capital(state, sid_0);
-				auto coast_1 = province::state_get_coastal_capital(state, sid_1);
-				path = province::make_naval_path(state, coast_0, coast_1);
-				p_prev = coast_0;
-
-				auto ps = path.size();
-				auto effective_distance = 0.f;
-				auto worst_movement_cost = 0.f;
-
-				for(size_t i = 0; i < ps; i++) {
-					auto p_current = path[i];
-					auto adj = state.world.get_province_adjacency_by_province_pair(p_prev, p_current);
-					float distance = province::distance(state, adj);
-					float sum_mods =
-						state.world.province_get_modifier_values(p_current, sys::provincial_mod_offsets::movement_cost)
-						+ state.world.province_get_modifier_values(p_prev, sys::provincial_mod_offsets::movement_cost);
-					effective_distance += std::max(0.01f, distance * std::max(0.01f, (sum_mods * 2.f + 1.0f)));
-					if(sum_mods > worst_movement_cost)
-						worst_movement_cost = std::max(0.01f, sum_mods);
-
-					p_prev = p_current;
-				}
-				state.world.trade_route_set_sea_distance(route, effective_distance / speed);
+	// every route is measured by the search started from its first market: one search per market finds the distances to all the
+	// markets it trades with, and the searches of different markets run in parallel
+	std::vector<std::vector<dcon::trade_route_id>> routes_of_market(state.world.market_size());
+	for(auto route : state.world.in_trade_route) {
+		auto market = state.world.trade_route_get_connected_markets(route, 0);
+		routes_of_market[market.index()].push_back(route.id);
+	}
+
+	concurrency::parallel_for(uint32_t(0), uint32_t(routes_of_market.size()), [&](uint32_t index) {
+		auto& routes = routes_of_market[index];
+		if(routes.empty())
+			return;
+
+		dcon::market_id market{ dcon::market_id::value_base_t(index) };
+		auto sid_0 = state.world.market_get_zone_from_local_market(market);
+
+		std::vector<dcon::province_id> sea_targets;
+		std::vector<dcon::province_id> land_targets;
+		std::vector<float> sea_distances;
+		std::vector<float> land_distances;
+		for(auto route : routes) {
+			auto sid_1 = state.world.market_get_zone_from_local_market(state.world.trade_route_get_connected_markets(route, 1));
+			sea_targets.push_back(state.world.trade_route_get_is_sea_route(route) ? province::state_get_coastal_capital(state, sid_1) : dcon::province_id{ });
+			land_targets.push_back(state.world.trade_route_get_is_land_route(route) ? state.world.state_instance_get_capital(sid_1) : dcon::province_id{ });
+		}
+
+		find_trade_distances(state, trade_path_kind::sea, province::state_get_coastal_capital(state, sid_0), sea_targets, sea_distances);
+		find_trade_distances(state, trade_path_kind::land, state.world.state_instance_get_capital(sid_0), land_targets, land_distances);
+
+		for(uint32_t i = 0; i < routes.size(); ++i) {
+			auto route = routes[i];
+			if(state.world.trade_route_get_is_sea_route(route)) {
+				state.world.trade_route_set_sea_distance(route, sea_distances[i] / base_speed);
 			} else {
 				state.world.trade_route_set_sea_distance(route, 99999.f);
 			}
-
 			if(state.world.trade_route_get_is_land_route(route)) {
-				std::vector<dcon::province_id> path{ };
-				auto speed = base_speed;
-				dcon::province_id p_prev{ };
-
-				auto market_0_center = state.world.state_instance_get_capital(sid_0);
-				auto market_1_center = state.world.state_instance_get_capital(sid_1);
-				path = province::make_unowned_path(state, market_0_center, market_1_center);
-				speed *= 0.2f;
-				p_prev = market_0_center;
-
-				auto ps = path.size();
-				auto effective_distance = 0.f;
-				auto worst_movement_cost = 0.f;
-				auto min_railroad_level = 0.f;
-
-				for(size_t i = 0; i < ps; i++) {
-					auto p_current = path[i];
-					auto adj = state.world.get_province_adjacency_by_province_pair(p_prev, p_current);
-					float distance = province::distance(state, adj);
-					float sum_mods =
-						state.world.province_get_modifier_values(p_current, sys::provincial_mod_offsets::movement_cost)
-						+ state.world.province_get_modifier_values(p_prev, sys::provincial_mod_offsets::movement_cost);
-					float local_effective_distance = distance * std::max(0.01f, sum_mods * 3.f);
-					auto railroad_origin = state.world.province_get_building_level(p_prev, uint8_t(economy::province_building_type::railroad));
-					auto railroad_target = state.world.province_get_building_level(p_current, uint8_t(economy::province_building_type::railroad));
-					if(railroad_origin > 0 && railroad_target > 0) {
-						local_effective_distance = local_effective_distance / 2.f;
-					}
-					local_effective_distance -= 0.03f * std::min(railroad_target, railroad_origin) * local_effective_distance;
-					effective_distance += std::max(0.01f, local_effective_distance);
-					if(sum_mods > worst_movement_cost)
-						worst_movement_cost = std::max(0.01f, sum_mods);
-
-					p_prev = p_current;
-				}
-				state.world.trade_route_set_land_distance(route, effective_distance / speed);
+				state.world.trade_route_set_land_distance(route, land_distances[i] / (base_speed * 0.2f));
 			} else {
 				state.world.trade_route_set_land_distance(route, 99999.f);
 			}
-		}, sids_0, sids_1, routes);
+		}
 	});
 }
 
@@ -286,22 +377,15 @@ struct parent_link {
 };
 
 void generate_sea_trade_routes(sys::state& state) {
-	float total_transport_speed = 0.f;
-	float total_amount_of_transports = 0.f;
+	auto base_speed = trade_transport_speed(state);
 
-	for(uint32_t i = 2; i < state.military_definitions.unit_base_definitions.size(); ++i) {
-		dcon::unit_type_id j{ dcon::unit_type_id::value_base_t(i) };
-		if(state.military_definitions.unit_base_definitions[j].type == military::unit_type::transport) {
-			total_transport_speed += state.military_definitions.unit_base_definitions[j].maximum_speed;
-			total_amount_of_transports += 1.f;
-		}
-	}
-
-	auto base_speed = total_transport_speed / total_amount_of_transports;
-
-	// buffer for "capitals" of connected regions:
-	std::array<dcon::state_instance_id, 4000> capital_of_region = {};
-	std::array<float, 10000> population_of_region = { };
+	// buffers for "capitals" of connected regions, indexed by connected coast id:
+	uint32_t region_count = 1;
+	state.world.for_each_province([&](auto p) {
+		region_count = std::max(region_count, uint32_t(state.world.province_get_connected_coast_id(p)) + 1);
+	});
+	std::vector<dcon::state_instance_id> capital_of_region(region_count);
+	std::vector<float> population_of_region(region_count, 0.f);
 	std::vector<float> nation_to_max_population = { };
 	nation_to_max_population.resize(state.world.nation_size());
 
@@ -348,13 +432,27 @@ void generate_sea_trade_routes(sys::state& state) {
 		world_population += state.world.nation_get_demographics(nation, demographics::total);
 	});
 
-	state.world.for_each_state_instance([&](auto origin) {
-		if(!province::state_is_coastal(state, origin))
-			return;
+	struct sea_route_candidate {
+		dcon::state_instance_id target;
+		float mult = 1.f;
+		float score_origin = 0.f;
+		float score_target = 0.f;
+		bool must_connect = false;
+	};
+
+	// partners of every coastal state are scored in parallel, with one search from its coast to all the partners that pass the
+	// direct distance approximation; the new routes are then created serially, in the order of the states
+	std::vector<dcon::state_instance_id> coastal_states;
+	state.world.for_each_state_instance([&](auto sid) {
+		if(province::state_is_coastal(state, sid))
+			coastal_states.push_back(sid);
+	});
+	std::vector<std::vector<dcon::state_instance_id>> new_partners(coastal_states.size());
 
+	concurrency::parallel_for(uint32_t(0), uint32_t(coastal_states.size()), [&](uint32_t index) {
+		auto origin = coastal_states[index];
 		auto market = state.world.state_instance_get_market_from_local_market(origin);
 
-		auto capital = state.world.state_instance_get_capital(origin);
 		auto owner = state.world.state_instance_get_nation_from_state_ownership(origin);
 		auto state_owner_capital = state.world.nation_get_capital(owner);
 		auto state_owner_capital_state = state.world.province_get_state_membership(state_owner_capital);
@@ -363,22 +461,19 @@ void generate_sea_trade_routes(sys::state& state) {
 		auto population_origin = state.world.state_instance_get_demographics(origin, demographics::total);
 		auto coast_0 = province::state_get_coastal_capital(state, origin);
 		auto connected_region = state.world.province_get_connected_coast_id(coast_0);
-		auto connected_region_size = 0.f;
 
-		state.world.for_each_state_instance([&](auto sid) {
+		std::vector<sea_route_candidate> candidates;
+		std::vector<dcon::province_id> candidate_coasts;
+
+		for(auto sid : coastal_states) {
 			if(sid == origin)
-				return;
-			if(!province::state_is_coastal(state, sid))
-				return;
+				continue;
 
 			auto coast_1 = province::state_get_coastal_capital(state, sid);
 
 			auto target_market = state.world.state_instance_get_market_from_local_market(sid);
-			auto route = state.world.get_trade_route_by_province_pair(market, target_market);
-			if(route) {
-				state.world.trade_route_set_is_sea_route(route, true);
-				return;
-			}
+			if(state.world.get_trade_route_by_province_pair(market, target_market))
+				continue;
 
 			bool same_owner = false;
 			bool different_region = false;
@@ -389,7 +484,6 @@ void generate_sea_trade_routes(sys::state& state) {
 				same_owner = true;
 			}
 
-			auto capital_target = state.world.state_instance_get_capital(sid);
 			auto connected_region_target = state.world.province_get_connected_coast_id(coast_1);
 			if(connected_region != connected_region_target) {
 				different_region = true;
@@ -412,19 +506,13 @@ void generate_sea_trade_routes(sys::state& state) {
 			}
 
 			auto naval_base_target = military::state_naval_base_level(state, sid);
-			auto state_target_owner_capital = state.world.nation_get_capital(target_owner);
-			auto state_target_owner_capital_state = state.world.province_get_state_membership(state_target_owner_capital);
-			auto continent_target = state.world.province_get_continent(coast_1);
-			auto continent_origin = state.world.province_get_continent(state_owner_capital);
 
 			float mult = 1.f;
 			mult += std::min(naval_base_origin, naval_base_target) * 0.25f;
 			bool must_connect = same_owner && different_region && capital_and_connected_region;
 
-			
 			auto distance_approximation = province::direct_distance(state, coast_0, coast_1) / base_speed;
 
-
 			float score_origin = population_origin;
 			float score_target = state.world.state_instance_get_demographics(sid, demographics::total);
 			if(capital_of_region[connected_region_target] == sid && capital_of_region[connected_region] == origin) {
@@ -436,45 +524,50 @@ void generate_sea_trade_routes(sys::state& state) {
 			float score_approximation = mult * M * score_origin * score_target / distance_approximation / distance_approximation / distance_approximation;
 
 			if(!(score_approximation >= 1.f || must_connect)) {
-				return;
+				continue;
 			}
 
-			auto distance = 9999.f;
-			{
-				std::vector<dcon::province_id> path{ };
-				auto speed = base_speed;
-				dcon::province_id p_prev{ };
-				path = province::make_naval_path(state, coast_0, coast_1);
-				p_prev = coast_0;
-
-				auto ps = path.size();
-				auto effective_distance = 0.f;
-				auto worst_movement_cost = 0.f;
-
-				for(size_t i = 0; i < ps; i++) {
-					auto p_current = path[i];
-					auto adj = state.world.get_province_adjacency_by_province_pair(p_prev, p_current);
-					float local_distance = province::distance(state, adj);
-					float sum_mods =
-						state.world.province_get_modifier_values(p_current, sys::provincial_mod_offsets::movement_cost)
-						+ state.world.province_get_modifier_values(p_prev, sys::provincial_mod_offsets::movement_cost);
-					effective_distance += std::max(0.01f, local_distance * std::max(0.01f, (sum_mods * 2.f + 1.0f)));
-					if(sum_mods > worst_movement_cost)
-						worst_movement_cost = std::max(0.01f, sum_mods);
-
-					p_prev = p_current;
-				}
-				distance = effective_distance / speed;
+			candidates.push_back(sea_route_candidate{ sid, mult, score_origin, score_target, must_connect });
+			candidate_coasts.push_back(coast_1);
+		}
+
+		std::vector<float> distances;
+		find_trade_distances(state, trade_path_kind::sea, coast_0, candidate_coasts, distances);
+
+		for(uint32_t i = 0; i < candidates.size(); ++i) {
+			auto& c = candidates[i];
+			auto distance = distances[i] / base_speed;
+			float score = c.mult * M * c.score_origin * c.score_target / distance / distance / distance;
+
+			if(score >= 1.f || c.must_connect) {
+				new_partners[index].push_back(c.target);
 			}
+		}
+	});
+
+	for(uint32_t index = 0; index < coastal_states.size(); ++index) {
+		auto market = state.world.state_instance_get_market_from_local_market(coastal_states[index]);
+		auto& partners = new_partners[index];
+		uint32_t next_partner = 0;
 
-			float score = mult * M * score_origin * score_target / distance / distance / distance;
+		for(auto sid : coastal_states) {
+			if(sid == coastal_states[index])
+				continue;
 
-			if(score >= 1.f || must_connect) {
+			auto target_market = state.world.state_instance_get_market_from_local_market(sid);
+			bool is_new_partner = next_partner < partners.size() && partners[next_partner] == sid;
+			if(is_new_partner)
+				++next_partner;
+
+			auto route = state.world.get_trade_route_by_province_pair(market, target_market);
+			if(route) {
+				state.world.trade_route_set_is_sea_route(route, true);
+			} else if(is_new_partner) {
 				auto new_route = state.world.force_create_trade_route(market, target_market);
 				state.world.trade_route_set_is_sea_route(new_route, true);
 			}
-		});
-	});
+		}
+	}
 
 	// connect to each other coastal connectivity components:
 	std::vector<parent_link> best_parent;
@@ -703,8 +796,10 @@ bool global_national_state::is_global_flag_variable_set(dcon::global_flag_id id)
 }
 
 void global_national_state::set_global_flag_variable(dcon::global_flag_id id, bool state) {
-	if(id)
+	if(id) {
 		dcon::bit_vector_set(global_flag_variables.data(), id.index(), state);
+		++global_flag_epoch;
+	}
 }
 
 dcon::text_key name_from_tag(sys::state& state, dcon::national_identity_id tag) {
@@ -1097,6 +1192,7 @@ void update_great_powers(sys::state& state) {
 					rel.get_influence_target().set_in_sphere_of(dcon::nation_id{});
 				state.world.delete_gp_relationship(rel);
 			}
+			province::invalidate_path_cache(state, n);
 
 			notification::post(state, notification::message{
 				[n](sys::state& state, text::layout_base& contents) {
@@ -1117,6 +1213,7 @@ void update_great_powers(sys::state& state) {
 			state.great_nations.push_back(sys::great_nation(state.current_date, n));
 			state.world.nation_set_state_from_flashpoint_focus(n, dcon::state_instance_id{});
 
+			province::invalidate_path_cache(state, state.world.nation_get_in_sphere_of(n));
 			state.world.nation_set_in_sphere_of(n, dcon::nation_id{});
 			auto rng = state.world.nation_get_gp_relationship_as_influence_target(n);
 			while(rng.begin() != rng.end()) {
@@ -1886,6 +1983,7 @@ void cleanup_nation(sys::state& state, dcon::nation_id n) {
 				sys::message_base_type::rem_sphere
 			});
 			o.set_in_sphere_of(dcon::nation_id{});
+			province::invalidate_path_cache(state, n);
 		}
 	}
 
@@ -1926,12 +2024,14 @@ void destroy_diplomatic_relationships(sys::state& state, dcon::nation_id n) {
 				i.set_in_sphere_of(dcon::nation_id{});
 			state.world.delete_gp_relationship(*(gp_relationships.begin()));
 		}
+		province::invalidate_path_cache(state, n);
 	}
 	{
 		auto gp_relationships = state.world.nation_get_gp_relationship_as_influence_target(n);
 		while(gp_relationships.begin() != gp_relationships.end()) {
 			state.world.delete_gp_relationship(*(gp_relationships.begin()));
 		}
+		province::invalidate_path_cache(state, state.world.nation_get_in_sphere_of(n));
 		state.world.nation_set_in_sphere_of(n, dcon::nation_id{});
 	}
 	{
@@ -1957,6 +2057,7 @@ void release_vassal(sys::state& state, dcon::overlord_id rel) {
 		}
 		state.world.nation_get_vassals_count(ol)--;
 		state.world.delete_overlord(rel);
+		province::invalidate_path_cache(state, ol);
 		politics::update_displayed_identity(state, vas);
 		// TODO: notify player
 	}
@@ -1982,6 +2083,7 @@ void make_vassal(sys::state& state, dcon::nation_id subject, dcon::nation_id ove
 	} else {
 		state.world.force_create_overlord(subject, overlord);
 		state.world.nation_get_vassals_count(overlord)++;
+		province::invalidate_path_cache(state, overlord);
 		politics::update_displayed_identity(state, subject);
 	}
 }
@@ -2007,6 +2109,7 @@ void make_substate(sys::state& state, dcon::nation_id subject, dcon::nation_id o
 		state.world.nation_set_is_substate(subject, true);
 		state.world.nation_get_vassals_count(overlord)++;
 		state.world.nation_get_substates_count(current_ruler)++;
+		province::invalidate_path_cache(state, overlord);
 		politics::update_displayed_identity(state, subject);
 	}
 }
@@ -3159,6 +3262,7 @@ void adjust_influence_with_overflow(sys::state& state, dcon::nation_id great_pow
 		if(state.world.nation_get_in_sphere_of(target) == great_power) {
 			inf += state.defines.addtosphere_influence_cost;
 			state.world.nation_set_in_sphere_of(target, dcon::nation_id{});
+			province::invalidate_path_cache(state, great_power);
 
 			auto& l = state.world.gp_relationship_get_status(rel);
 			l = nations::influence::decrease_level(l);
@@ -3175,6 +3279,7 @@ void adjust_influence_with_overflow(sys::state& state, dcon::nation_id great_pow
 			inf -= state.defines.removefromsphere_influence_cost;
 			auto affected_gp = state.world.nation_get_in_sphere_of(target);
 			state.world.nation_set_in_sphere_of(target, dcon::nation_id{});
+			province::invalidate_path_cache(state, affected_gp);
 			{
 				auto orel = state.world.get_gp_relationship_by_gp_influence_pair(target, affected_gp);
 				auto& l = state.world.gp_relationship_get_status(orel);
@@ -3182,6 +3287,7 @@ void adjust_influence_with_overflow(sys::state& state, dcon::nation_id great_pow
 			}
 		} else if((state.world.gp_relationship_get_status(rel) & influence::level_mask) == influence::level_friendly) {
 			state.world.nation_set_in_sphere_of(target, great_power);
+			province::invalidate_path_cache(state, great_power);
 			inf -= state.defines.addtosphere_influence_cost;
 			auto& l = state.world.gp_relationship_get_status(rel);
 			l = nations::influence::increase_level(l);
@@ -70,6 +70,7 @@ enum class focus_type : uint8_t {
 struct global_national_state {
 	std::vector<triggered_modifier> triggered_modifiers;
 	std::vector<dcon::bitfield_type> global_flag_variables;
+	uint32_t global_flag_epoch = 0; // incremented whenever a global flag is set or cleared (not saved)
 	std::vector<dcon::nation_id> nations_by_rank;
 
 	tagged_vector<dcon::text_key, dcon::national_flag_id> flag_variable_names;
@@ -702,6 +702,12 @@
 	LUA_DEFINES_LIST_ELEMENT(alice_take_province_militancy_subject, 2.0) \
 	LUA_DEFINES_LIST_ELEMENT(alice_take_province_militancy_all_subjects, 1.0) \
 	LUA_DEFINES_LIST_ELEMENT(alice_ai_strength_estimation_military_industrial_balance, 1.0) \
+	LUA_DEFINES_LIST_ELEMENT(alice_compact_pops, 0.0) \
+	LUA_DEFINES_LIST_ELEMENT(alice_incremental_demographics, 0.0) \
+	LUA_DEFINES_LIST_ELEMENT(alice_hierarchical_path_min_distance, 400.0) \
+	LUA_DEFINES_LIST_ELEMENT(alice_hierarchical_path_bound, 2.0) \
+	LUA_DEFINES_LIST_ELEMENT(alice_hierarchical_path_corridor_width, 1.0) \
+	LUA_DEFINES_LIST_ELEMENT(alice_path_cache_size, 0.0) \
 
 
 // scales the needs values so that they are needs per this many pops
@@ -2,6 +2,7 @@
 #include "parsers_declarations.hpp"
 #include "script_constants.hpp"
 #include <algorithm>
+#include <functional>
 
 namespace parsers {
 
@@ -865,6 +866,182 @@ int32_t simplify_trigger(uint16_t* source) {
 	}
 }
 
+//
+// Optimization pass over the bytecode of the triggers, run once the whole scenario has been parsed. Subtriggers have no side
+// effects and the members of a scope are only combined with and / or, so the pass is free to fold constants, to drop members that
+// can't change the result, to remove duplicated members and to put the cheaper members first, which lets apply_conjuctively and
+// apply_disjuctively stop earlier without changing what any trigger evaluates to
+//
+
+// 1 if the trigger is always true, -1 if it is always false and 0 otherwise
+int32_t trigger_constant_value(uint16_t const* source) {
+	if((source[0] & trigger::code_mask) != trigger::always)
+		return 0;
+	switch(source[0] & trigger::association_mask) {
+	case trigger::association_gt:
+	case trigger::association_lt:
+	case trigger::association_ne:
+		return -1;
+	default:
+		return 1;
+	}
+}
+
+int32_t scope_cost_multiplier(uint16_t code) {
+	switch(code) {
+	case trigger::generic_scope:
+		return 0;
+	case trigger::x_core_scope_province:
+	case trigger::x_war_countries_scope_nation:
+	case trigger::x_war_countries_scope_pop:
+	case trigger::x_substate_scope:
+		return 4;
+	case trigger::x_neighbor_province_scope:
+	case trigger::x_neighbor_country_scope_nation:
+	case trigger::x_neighbor_country_scope_pop:
+	case trigger::x_greater_power_scope:
+	case trigger::x_owned_province_scope_state:
+	case trigger::x_state_scope:
+	case trigger::x_sphere_member_scope:
+		return 8;
+	case trigger::x_neighbor_province_scope_state:
+	case trigger::x_pop_scope_province:
+	case trigger::x_provinces_in_variable_region:
+	case trigger::x_provinces_in_variable_region_proper:
+		return 16;
+	case trigger::x_owned_province_scope_nation:
+	case trigger::x_core_scope_nation:
+		return 32;
+	case trigger::x_pop_scope_state:
+	case trigger::x_country_scope:
+		return 64;
+	case trigger::x_pop_scope_nation:
+		return 256;
+	default: // scopes that move to a single other object
+		return 1;
+	}
+}
+
+// rough relative cost of evaluating a trigger, only used to order the members of a scope
+int32_t estimate_trigger_cost(uint16_t const* source) {
+	constexpr int32_t max_cost = 1 << 24;
+	auto const code = uint16_t(source[0] & trigger::code_mask);
+	if(code < trigger::first_scope_code) {
+		if(code == trigger::test) // runs a stored trigger, whose cost is unknown here
+			return 16;
+		return 1;
+	}
+
+	auto const source_size = 1 + trigger::get_trigger_scope_payload_size(source);
+	int32_t members_cost = 0;
+	for(auto sub = source + 2 + trigger::trigger_scope_data_payload(source[0]); sub < source + source_size; sub += 1 + trigger::get_trigger_payload_size(sub)) {
+		members_cost = std::min(members_cost + estimate_trigger_cost(sub), max_cost);
+	}
+	auto const multiplier = scope_cost_multiplier(code);
+	if(multiplier == 0)
+		return members_cost;
+	return int32_t(std::min(int64_t(multiplier) * int64_t(1 + members_cost), int64_t(max_cost)));
+}
+
+// yields new source size, which is never larger than the old one
+int32_t optimize_trigger(uint16_t* source) {
+	if((source[0] & trigger::code_mask) < trigger::first_scope_code)
+		return 1 + trigger::get_trigger_non_scope_payload_size(source);
+
+	auto const source_size = 1 + trigger::get_trigger_scope_payload_size(source);
+	auto const first_member = source + 2 + trigger::trigger_scope_data_payload(source[0]);
+	bool const is_generic = (source[0] & trigger::code_mask) == trigger::generic_scope;
+	bool const disjunctive = (source[0] & trigger::is_disjunctive_scope) != 0;
+	int32_t const deciding_value = disjunctive ? 1 : -1; // a member with this constant value decides the result by itself
+
+	std::vector<std::vector<uint16_t>> members;
+	for(auto sub = first_member; sub < source + source_size;) {
+		auto const old_size = 1 + trigger::get_trigger_payload_size(sub);
+		auto const new_size = optimize_trigger(sub);
+		if((sub[0] & trigger::code_mask) == trigger::generic_scope && ((sub[0] & trigger::is_disjunctive_scope) != 0) == disjunctive) {
+			// a nested and / or of the same kind: its members become members of this scope
+			for(auto inner = sub + 2; inner < sub + new_size; inner += 1 + trigger::get_trigger_payload_size(inner))
+				members.emplace_back(inner, inner + 1 + trigger::get_trigger_payload_size(inner));
+		} else {
+			members.emplace_back(sub, sub + new_size);
+		}
+		sub += old_size;
+	}
+
+	if(auto it = std::find_if(members.begin(), members.end(), [&](auto const& m) { return trigger_constant_value(m.data()) == deciding_value; }); it != members.end()) {
+		auto deciding_member = std::move(*it);
+		members.clear();
+		members.push_back(std::move(deciding_member));
+	} else {
+		// constants that can't decide the result and repeated members are dropped
+		std::vector<std::vector<uint16_t>> kept;
+		for(auto& m : members) {
+			if(trigger_constant_value(m.data()) != 0)
+				continue;
+			if(std::find(kept.begin(), kept.end(), m) != kept.end())
+				continue;
+			kept.push_back(std::move(m));
+		}
+		members = std::move(kept);
+
+		std::vector<int32_t> costs;
+		for(auto& m : members)
+			costs.push_back(estimate_trigger_cost(m.data()));
+		std::vector<int32_t> order(members.size());
+		for(int32_t i = 0; i < int32_t(order.size()); ++i)
+			order[i] = i;
+		std::stable_sort(order.begin(), order.end(), [&](int32_t a, int32_t b) { return costs[a] < costs[b]; });
+		std::vector<std::vector<uint16_t>> sorted;
+		for(auto i : order)
+			sorted.push_back(std::move(members[i]));
+		members = std::move(sorted);
+	}
+
+	if(is_generic && members.empty()) { // an empty and is true, an empty or is false
+		source[0] = uint16_t(trigger::always | trigger::no_payload | (disjunctive ? trigger::association_ne : trigger::association_eq));
+		return 1;
+	}
+	if(is_generic && members.size() == 1) {
+		std::copy(members[0].begin(), members[0].end(), source);
+		return int32_t(members[0].size());
+	}
+
+	auto out = first_member;
+	for(auto& m : members)
+		out = std::copy(m.begin(), m.end(), out);
+	source[1] = uint16_t(out - source - 1);
+	return int32_t(out - source);
+}
+
+void optimize_trigger_data(sys::state& state) {
+	auto& data = state.optimized_trigger_data;
+	auto& indices = state.optimized_trigger_data_indices;
+	data.clear();
+	indices.clear();
+	if(state.trigger_data_indices.empty())
+		return;
+
+	// the parsed triggers are left as they are for the tooltips. They may share their storage with each other (see
+	// commit_trigger_data), so every trigger is copied out, optimized and stored again under the same key
+	data.push_back(state.trigger_data[0]); // placeholder for invalid triggers
+	indices.push_back(0);
+
+	std::vector<uint16_t> t;
+	for(size_t i = 1; i < state.trigger_data_indices.size(); ++i) {
+		auto const start = state.trigger_data.data() + state.trigger_data_indices[i];
+		t.assign(start, start + 1 + trigger::get_trigger_payload_size(start));
+		t.resize(size_t(optimize_trigger(t.data())));
+
+		auto search_result = std::search(data.data() + 1, data.data() + data.size(), std::boyer_moore_horspool_searcher(t.data(), t.data() + t.size()));
+		if(search_result != data.data() + data.size()) {
+			indices.push_back(int32_t(search_result - data.data()));
+		} else {
+			indices.push_back(int32_t(data.size()));
+			data.insert(data.end(), t.begin(), t.end());
+		}
+	}
+}
+
 dcon::trigger_key make_trigger(token_generator& gen, error_handler& err, trigger_building_context& context) {
 	tr_scope_and(gen, err, context);
 
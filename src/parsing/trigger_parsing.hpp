@@ -6009,6 +6009,9 @@ void invert_trigger(uint16_t* source);
 bool scope_is_empty(uint16_t const* source);
 bool scope_has_single_member(uint16_t const* source);
 int32_t simplify_trigger(uint16_t* source);
+int32_t estimate_trigger_cost(uint16_t const* source);
+int32_t optimize_trigger(uint16_t* source);
+void optimize_trigger_data(sys::state& state);
 dcon::trigger_key make_trigger(token_generator& gen, error_handler& err, trigger_building_context& context);
 
 struct value_modifier_definition {
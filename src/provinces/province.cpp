@@ -5,6 +5,7 @@
 #include "nations.hpp"
 #include "system_state.hpp"
 #include <vector>
+#include <limits>
 #include "rebels.hpp"
 #include "math_fns.hpp"
 #include "prng.hpp"
@@ -27,11 +28,180 @@ bool nations_are_adjacent(sys::state& state, dcon::nation_id a, dcon::nation_id
 	auto it = state.world.get_nation_adjacency_by_nation_adjacency_pair(a, b);
 	return bool(it);
 }
+static bool joins_connected_region(dcon::province_adjacency_fat_id rel) {
+	// not entering sea, not impassible, both have the same owner
+	return (rel.get_type() & (province::border::coastal_bit | province::border::impassible_bit)) == 0
+		&& rel.get_connected_provinces(0).get_nation_from_province_ownership() == rel.get_connected_provinces(1).get_nation_from_province_ownership();
+}
+
+static bool joins_connected_coast(dcon::province_adjacency_fat_id rel) {
+	return joins_connected_region(rel) && rel.get_connected_provinces(0).get_is_coast() == rel.get_connected_provinces(1).get_is_coast();
+}
+
+//
+// gives new ids to the provinces of every connected region (or coast) that contains, or borders, a province that changed owner, by
+// flooding them again; all other regions keep their ids. Ids freed this way are given out again before new ones are made
+//
+template<bool coast>
+static void refill_changed_regions(sys::state& state, std::vector<province_owner_change> const& changes) {
+	auto get_id = [&](dcon::province_id p) {
+		return coast ? state.world.province_get_connected_coast_id(p) : state.world.province_get_connected_region_id(p);
+	};
+	auto set_id = [&](dcon::province_id p, uint16_t v) {
+		if constexpr(coast)
+			state.world.province_set_connected_coast_id(p, v);
+		else
+			state.world.province_set_connected_region_id(p, v);
+	};
+	auto joins = [](dcon::province_adjacency_fat_id rel) {
+		return coast ? joins_connected_coast(rel) : joins_connected_region(rel);
+	};
+	auto first_sea = state.province_definitions.first_sea_province.index();
+
+	uint16_t max_id = 0;
+	for(int32_t i = first_sea; i-- > 0;) {
+		max_id = std::max(max_id, uint16_t(get_id(dcon::province_id{ dcon::province_id::value_base_t(i) })));
+	}
+
+	static std::vector<bool> affected;
+	affected.assign(size_t(max_id) + 1, false);
+	for(auto& c : changes) {
+		affected[get_id(c.province)] = true;
+		for(auto rel : state.world.province_get_province_adjacency(c.province)) {
+			if((rel.get_type() & (province::border::coastal_bit | province::border::impassible_bit)) == 0) {
+				affected[get_id(rel.get_connected_provinces(0))] = true;
+				affected[get_id(rel.get_connected_provinces(1))] = true;
+			}
+		}
+	}
+	affected[0] = false; // not part of any region
+
+	static std::vector<uint16_t> free_ids;
+	static std::vector<dcon::province_id> members;
+	free_ids.clear();
+	members.clear();
+	for(uint16_t i = 1; i <= max_id; ++i) {
+		if(affected[i])
+			free_ids.push_back(i);
+	}
+	for(int32_t i = first_sea; i-- > 0;) {
+		dcon::province_id id{ dcon::province_id::value_base_t(i) };
+		if(affected[get_id(id)]) {
+			set_id(id, 0);
+			members.push_back(id);
+		}
+	}
+
+	static std::vector<dcon::province_id> to_fill_list;
+	uint32_t next_free = 0;
+	for(auto id : members) {
+		if(get_id(id) != 0)
+			continue;
+
+		uint16_t fill_id = next_free < free_ids.size() ? free_ids[next_free++] : ++max_id;
+		bool found_coast = false;
+
+		to_fill_list.push_back(id);
+		while(!to_fill_list.empty()) {
+			auto current_id = to_fill_list.back();
+			to_fill_list.pop_back();
+
+			found_coast = found_coast || state.world.province_get_is_coast(current_id);
+
+			set_id(current_id, fill_id);
+			for(auto rel : state.world.province_get_province_adjacency(current_id)) {
+				if(joins(rel)) {
+					if(get_id(rel.get_connected_provinces(0)) == 0)
+						to_fill_list.push_back(rel.get_connected_provinces(0));
+					if(get_id(rel.get_connected_provinces(1)) == 0)
+						to_fill_list.push_back(rel.get_connected_provinces(1));
+				}
+			}
+		}
+
+		if constexpr(!coast) {
+			auto& is_coastal = state.province_definitions.connected_region_is_coastal;
+			if(is_coastal.size() < fill_id)
+				is_coastal.resize(fill_id, false);
+			is_coastal[fill_id - 1] = found_coast;
+		}
+	}
+}
+
+//
+// recomputes the adjacency of the nations that lost or gained a province and of the owners of the provinces bordering it: no other
+// pair of nations can have started or stopped sharing a border
+//
+static void update_changed_nation_adjacency(sys::state& state, std::vector<province_owner_change> const& changes) {
+	static std::vector<dcon::nation_id> nations;
+	static std::vector<dcon::nation_adjacency_id> removed;
+	nations.clear();
+	removed.clear();
+
+	auto add_nation = [&](dcon::nation_id n) {
+		if(n && std::find(nations.begin(), nations.end(), n) == nations.end())
+			nations.push_back(n);
+	};
+	for(auto& c : changes) {
+		add_nation(c.old_owner);
+		add_nation(state.world.province_get_nation_from_province_ownership(c.province));
+		for(auto rel : state.world.province_get_province_adjacency(c.province)) {
+			add_nation(rel.get_connected_provinces(0).get_nation_from_province_ownership());
+			add_nation(rel.get_connected_provinces(1).get_nation_from_province_ownership());
+		}
+	}
+
+	for(auto n : nations) {
+		for(auto adj : state.world.nation_get_nation_adjacency(n)) {
+			removed.push_back(adj.id);
+		}
+	}
+	// deleting moves the last adjacency into the freed slot, so delete from the highest id down
+	std::sort(removed.begin(), removed.end(), [](dcon::nation_adjacency_id a, dcon::nation_adjacency_id b) { return a.index() > b.index(); });
+	removed.erase(std::unique(removed.begin(), removed.end()), removed.end());
+	for(auto adj : removed) {
+		state.world.delete_nation_adjacency(adj);
+	}
+
+	for(auto n : nations) {
+		for(auto o : state.world.nation_get_province_ownership(n)) {
+			for(auto rel : o.get_province().get_province_adjacency()) {
+				if((rel.get_type() & (province::border::coastal_bit | province::border::impassible_bit)) == 0) {
+					auto owner_a = rel.get_connected_provinces(0).get_nation_from_province_ownership();
+					auto owner_b = rel.get_connected_provinces(1).get_nation_from_province_ownership();
+					if(owner_a != owner_b)
+						state.world.try_create_nation_adjacency(owner_a, owner_b);
+				}
+			}
+		}
+	}
+}
+
 void update_connected_regions(sys::state& state) {
 	if(!state.adjacency_data_out_of_date)
 		return;
 
 	state.adjacency_data_out_of_date = false;
+
+	auto& changes = state.province_definitions.pending_owner_changes;
+	// a full rebuild numbers the regions in one fixed order, which the local update cannot preserve; in multiplayer every client
+	// must agree on the order of the nation adjacency, so the local update is single player only
+	if(state.province_definitions.connected_regions_valid && !changes.empty()
+		&& changes.size() * 8 <= size_t(state.province_definitions.first_sea_province.index())
+		&& state.network_mode == sys::network_mode_type::single_player) {
+
+		refill_changed_regions<false>(state, changes);
+		refill_changed_regions<true>(state, changes);
+		update_changed_nation_adjacency(state, changes);
+		changes.clear();
+
+		military::invalidate_unowned_wargoals(state);
+		state.province_ownership_changed.store(true, std::memory_order::release);
+		return;
+	}
+
+	changes.clear();
+	state.province_definitions.connected_regions_valid = true;
 	state.world.nation_adjacency_resize(0);
 
 	{
@@ -154,9 +324,31 @@ dcon::province_id pick_capital(sys::state& state, dcon::nation_id n) {
 	return best_choice;
 }
 
+// the nations that may move through the provinces of a controller (see has_access_to_province) have to find their paths again
+// when one of those provinces changes hands
+static void invalidate_controller_paths(sys::state& state, dcon::nation_id controller) {
+	if(!controller)
+		return;
+	invalidate_path_cache(state, controller);
+	invalidate_path_cache(state, state.world.nation_get_in_sphere_of(controller));
+	invalidate_path_cache(state, state.world.overlord_get_ruler(state.world.nation_get_overlord_as_subject(controller)));
+	for(auto ur : state.world.nation_get_unilateral_relationship_as_target(controller)) {
+		if(ur.get_military_access())
+			invalidate_path_cache(state, ur.get_source());
+	}
+	for(auto wp : state.world.nation_get_war_participant(controller)) {
+		for(auto o : wp.get_war().get_war_participant()) {
+			if(o.get_nation() != controller)
+				invalidate_path_cache(state, o.get_nation());
+		}
+	}
+}
+
 void set_province_controller(sys::state& state, dcon::province_id p, dcon::nation_id n) {
 	auto old_con = state.world.province_get_nation_from_province_control(p);
 	if(old_con != n) {
+		invalidate_controller_paths(state, old_con);
+		invalidate_controller_paths(state, n);
 		state.world.province_set_last_control_change(p, state.current_date);
 		auto rc = state.world.province_get_rebel_faction_from_province_rebel_control(p);
 		auto owner = state.world.province_get_nation_from_province_ownership(p);
@@ -185,6 +377,7 @@ void set_province_controller(sys::state& state, dcon::province_id p, dcon::natio
 void set_province_controller(sys::state& state, dcon::province_id p, dcon::rebel_faction_id rf) {
 	auto old_con = state.world.province_get_rebel_faction_from_province_rebel_control(p);
 	if(old_con != rf) {
+		invalidate_controller_paths(state, state.world.province_get_nation_from_province_control(p));
 		state.world.province_set_last_control_change(p, state.current_date);
 		auto owner = state.world.province_get_nation_from_province_ownership(p);
 		if(!old_con && owner) {
@@ -723,7 +916,12 @@ void change_province_owner(sys::state& state, dcon::province_id id, dcon::nation
 		return;
 
 	state.adjacency_data_out_of_date = true;
+	if(std::find_if(state.province_definitions.pending_owner_changes.begin(), state.province_definitions.pending_owner_changes.end(),
+			[id](province_owner_change const& c) { return c.province == id; }) == state.province_definitions.pending_owner_changes.end()) {
+		state.province_definitions.pending_owner_changes.push_back(province_owner_change{ id, old_owner });
+	}
 	state.national_cached_values_out_of_date = true;
+	invalidate_path_cache(state);
 
 	bool state_is_new = false;
 	dcon::state_instance_id new_si;
@@ -1734,6 +1932,8 @@ void set_rgo(sys::state& state, dcon::province_id prov, dcon::commodity_id c) {
 
 void enable_canal(sys::state& state, int32_t id) {
 	state.world.province_adjacency_get_type(state.province_definitions.canals[id]) &= ~province::border::impassible_bit;
+	build_region_graph(state);
+	invalidate_path_cache(state);
 }
 
 // distance between to adjacent provinces
@@ -1854,21 +2054,410 @@ struct province_and_distance {
 	}
 };
 
+struct retreat_province_and_distance {
+	float distance_covered = 0.0f;
+	dcon::province_id province;
+
+	bool operator<(retreat_province_and_distance const& other) const noexcept {
+		if(other.distance_covered != distance_covered)
+			return distance_covered > other.distance_covered;
+		return other.province.index() > province.index();
+	}
+};
+
+// the province each province was reached from during one search; every entry is stamped with the search that wrote it, so an
+// entry from an earlier search reads as unvisited and the buffer never has to be cleared between searches
+struct path_origins {
+	std::vector<dcon::province_id> origins;
+	std::vector<uint32_t> stamps;
+	uint32_t generation = 0;
+
+	dcon::province_id get(dcon::province_id p) const {
+		return stamps[p.index()] == generation ? origins[p.index()] : dcon::province_id{ };
+	}
+	void set(dcon::province_id p, dcon::province_id from) {
+		origins[p.index()] = from;
+		stamps[p.index()] = generation;
+	}
+};
+
+// heap entry of the search over the region graph that finds the corridor of a long land path
+struct region_and_distance {
+	float distance_covered = 0.0f;
+	float distance_to_target = 0.0f;
+	dcon::state_definition_id region;
+
+	bool operator<(region_and_distance const& other) const noexcept {
+		if(other.distance_covered + other.distance_to_target != distance_covered + distance_to_target)
+			return distance_covered + distance_to_target > other.distance_covered + other.distance_to_target;
+		return other.region.index() > region.index();
+	}
+};
+
+// scratch space of the pathfinding functions, one per thread, so that pathfinding from the parallel parts of the ai does not
+// allocate per search. The region buffers, used to find the corridor of long land paths, are stamped with the same generation as
+// the province origins
+struct path_workspace {
+	path_origins origins;
+	std::vector<province_and_distance> heap;
+	std::vector<retreat_province_and_distance> retreat_heap;
+
+	std::vector<float> region_distance;
+	std::vector<dcon::state_definition_id> region_parent;
+	std::vector<uint32_t> region_stamps;
+	std::vector<uint32_t> corridor_stamps;
+	std::vector<dcon::state_definition_id> region_frontier;
+	std::vector<dcon::state_definition_id> next_region_frontier;
+	std::vector<region_and_distance> region_heap;
+};
+
+static path_workspace& begin_path_search(sys::state& state) {
+	thread_local path_workspace workspace;
+
+	auto province_count = state.world.province_size();
+	auto region_count = state.world.state_definition_size();
+	auto& o = workspace.origins;
+	if(o.origins.size() != province_count || workspace.region_stamps.size() != region_count) {
+		o.origins.assign(province_count, dcon::province_id{ });
+		o.stamps.assign(province_count, 0);
+		workspace.region_distance.assign(region_count, 0.0f);
+		workspace.region_parent.assign(region_count, dcon::state_definition_id{ });
+		workspace.region_stamps.assign(region_count, 0);
+		workspace.corridor_stamps.assign(region_count, 0);
+		o.generation = 0;
+	}
+	++o.generation;
+	if(o.generation == 0) { // wrapped around: stamps from 2^32 searches ago would read as current
+		std::fill(o.stamps.begin(), o.stamps.end(), 0);
+		std::fill(workspace.region_stamps.begin(), workspace.region_stamps.end(), 0);
+		std::fill(workspace.corridor_stamps.begin(), workspace.corridor_stamps.end(), 0);
+		o.generation = 1;
+	}
+	workspace.heap.clear();
+	workspace.retreat_heap.clear();
+	return workspace;
+}
+
+void build_region_graph(sys::state& state) {
+	auto& defs = state.province_definitions;
+	auto region_count = state.world.state_definition_size();
+
+	// the center of a region is the province with the smallest distance to the farthest province of the region
+	defs.region_centers.assign(region_count, dcon::province_id{ });
+	for(auto d : state.world.in_state_definition) {
+		float best = std::numeric_limits<float>::max();
+		for(auto a : d.get_abstract_state_membership()) {
+			float farthest = 0.0f;
+			for(auto b : d.get_abstract_state_membership()) {
+				farthest = std::max(farthest, direct_distance(state, a.get_province(), b.get_province()));
+			}
+			if(farthest < best) {
+				best = farthest;
+				defs.region_centers[d.id.index()] = a.get_province();
+			}
+		}
+	}
+
+	// regions are linked when a land unit can step from one to the other
+	std::vector<std::pair<uint32_t, uint32_t>> pairs;
+	for(auto adj : state.world.in_province_adjacency) {
+		if((adj.get_type() & province::border::impassible_bit) != 0)
+			continue;
+		auto a = adj.get_connected_provinces(0);
+		auto b = adj.get_connected_provinces(1);
+		if(a.id.index() >= defs.first_sea_province.index() || b.id.index() >= defs.first_sea_province.index())
+			continue;
+		auto ra = a.get_state_from_abstract_state_membership();
+		auto rb = b.get_state_from_abstract_state_membership();
+		if(!ra || !rb || ra == rb || !defs.region_centers[ra.id.index()] || !defs.region_centers[rb.id.index()])
+			continue;
+		pairs.emplace_back(uint32_t(ra.id.index()), uint32_t(rb.id.index()));
+		pairs.emplace_back(uint32_t(rb.id.index()), uint32_t(ra.id.index()));
+	}
+	std::sort(pairs.begin(), pairs.end());
+	pairs.erase(std::unique(pairs.begin(), pairs.end()), pairs.end());
+
+	defs.region_links.clear();
+	defs.region_link_offsets.assign(region_count + 1, 0);
+	for(auto& p : pairs) {
+		dcon::state_definition_id to{ dcon::state_definition_id::value_base_t(p.second) };
+		defs.region_links.push_back(region_link{ to, direct_distance(state, defs.region_centers[p.first], defs.region_centers[p.second]) });
+		++defs.region_link_offsets[p.first + 1];
+	}
+	for(uint32_t i = 0; i < region_count; ++i) {
+		defs.region_link_offsets[i + 1] += defs.region_link_offsets[i];
+	}
+}
+
+// finds the shortest chain of regions between the regions of start and end, and marks it, widened by
+// alice_hierarchical_path_corridor_width rings of neighboring regions, as the corridor of the current search
+static bool find_region_corridor(sys::state& state, path_workspace& workspace, dcon::province_id start, dcon::province_id end) {
+	auto& defs = state.province_definitions;
+	auto from = state.world.province_get_state_from_abstract_state_membership(start);
+	auto to = state.world.province_get_state_from_abstract_state_membership(end);
+	if(!from || !to || from == to || defs.region_link_offsets.size() != workspace.region_stamps.size() + 1)
+		return false;
+
+	auto generation = workspace.origins.generation;
+	auto target_center = defs.region_centers[to.index()];
+	auto& heap = workspace.region_heap;
+	heap.clear();
+
+	workspace.region_distance[from.index()] = 0.0f;
+	workspace.region_parent[from.index()] = dcon::state_definition_id{ };
+	workspace.region_stamps[from.index()] = generation;
+	heap.push_back(region_and_distance{ 0.0f, direct_distance(state, defs.region_centers[from.index()], target_center), from });
+
+	bool found = false;
+	while(heap.size() > 0) {
+		std::pop_heap(heap.begin(), heap.end());
+		auto nearest = heap.back();
+		heap.pop_back();
+
+		if(nearest.distance_covered > workspace.region_distance[nearest.region.index()])
+			continue; // already reached by a shorter chain
+		if(nearest.region == to) {
+			found = true;
+			break;
+		}
+
+		for(auto i = defs.region_link_offsets[nearest.region.index()]; i < defs.region_link_offsets[nearest.region.index() + 1]; ++i) {
+			auto& link = defs.region_links[i];
+			auto d = nearest.distance_covered + link.distance;
+			if(workspace.region_stamps[link.to.index()] != generation || d < workspace.region_distance[link.to.index()]) {
+				workspace.region_stamps[link.to.index()] = generation;
+				workspace.region_distance[link.to.index()] = d;
+				workspace.region_parent[link.to.index()] = nearest.region;
+				heap.push_back(region_and_distance{ d, direct_distance(state, defs.region_centers[link.to.index()], target_center), link.to });
+				std::push_heap(heap.begin(), heap.end());
+			}
+		}
+	}
+	if(!found)
+		return false;
+
+	auto& frontier = workspace.region_frontier;
+	frontier.clear();
+	for(auto r = to; r; r = workspace.region_parent[r.index()]) {
+		workspace.corridor_stamps[r.index()] = generation;
+		frontier.push_back(r);
+	}
+	for(int32_t ring = 0; ring < int32_t(state.defines.alice_hierarchical_path_corridor_width); ++ring) {
+		auto& next = workspace.next_region_frontier;
+		next.clear();
+		for(auto r : frontier) {
+			for(auto i = defs.region_link_offsets[r.index()]; i < defs.region_link_offsets[r.index() + 1]; ++i) {
+				auto other = defs.region_links[i].to;
+				if(workspace.corridor_stamps[other.index()] != generation) {
+					workspace.corridor_stamps[other.index()] = generation;
+					next.push_back(other);
+				}
+			}
+		}
+		std::swap(frontier, next);
+	}
+	return true;
+}
+
+static bool in_region_corridor(sys::state& state, path_workspace const& workspace, dcon::province_id p) {
+	auto r = state.world.province_get_state_from_abstract_state_membership(p);
+	return r && workspace.corridor_stamps[r.index()] == workspace.origins.generation;
+}
+
+static float path_length(sys::state& state, dcon::province_id start, std::vector<dcon::province_id> const& path) {
+	float length = 0.0f;
+	auto prev = start;
+	for(auto i = path.size(); i-- > 0;) {
+		length += distance(state, state.world.get_province_adjacency_by_province_pair(prev, path[i]));
+		prev = path[i];
+	}
+	return length;
+}
+
+static uint64_t path_cache_key(path_kind kind, dcon::province_id start, dcon::province_id end, dcon::nation_id access_class) {
+	return uint64_t(start.index() + 1) | (uint64_t(end.index() + 1) << 20) | (uint64_t(access_class.index() + 1) << 40) | (uint64_t(kind) << 60);
+}
+
+static bool path_cache_enabled(sys::state& state) {
+	return state.defines.alice_path_cache_size >= 1.0f && state.network_mode == sys::network_mode_type::single_player;
+}
+
+static uint32_t nation_path_epoch(path_cache& cache, dcon::nation_id n) {
+	if(!n || uint32_t(n.index()) >= cache.nation_epochs.size())
+		return 0;
+	return cache.nation_epochs[n.index()];
+}
+
+static void unlink_path_entry(path_cache& cache, int32_t i) {
+	auto& e = cache.entries[i];
+	if(e.newer != -1)
+		cache.entries[e.newer].older = e.older;
+	else
+		cache.newest = e.older;
+	if(e.older != -1)
+		cache.entries[e.older].newer = e.newer;
+	else
+		cache.oldest = e.newer;
+	e.newer = -1;
+	e.older = -1;
+}
+
+static void link_path_entry_as_newest(path_cache& cache, int32_t i) {
+	auto& e = cache.entries[i];
+	e.newer = -1;
+	e.older = cache.newest;
+	if(cache.newest != -1)
+		cache.entries[cache.newest].newer = i;
+	cache.newest = i;
+	if(cache.oldest == -1)
+		cache.oldest = i;
+}
+
+// entries that are dropped stay in the list as the oldest ones, with a key of 0, and are reused first
+static void drop_path_entry(path_cache& cache, int32_t i) {
+	cache.index.erase(cache.entries[i].key);
+	cache.entries[i].key = 0;
+	cache.entries[i].path.clear();
+	unlink_path_entry(cache, i);
+	auto& e = cache.entries[i];
+	e.newer = cache.oldest;
+	if(cache.oldest != -1)
+		cache.entries[cache.oldest].older = i;
+	cache.oldest = i;
+	if(cache.newest == -1)
+		cache.newest = i;
+}
+
+// whether the nation can still follow a cached path: the destination itself is the caller's responsibility, as for a new search
+static bool cached_path_is_usable(sys::state& state, path_kind kind, std::vector<dcon::province_id> const& path, dcon::nation_id nation_as, dcon::army_id a) {
+	if(kind == path_kind::naval)
+		return true;
+	for(size_t i = 1; i < path.size(); ++i) {
+		auto p = path[i];
+		if(p.index() < state.province_definitions.first_sea_province.index()) {
+			if(!has_access_to_province(state, nation_as, p))
+				return false;
+		} else if(!military::can_embark_onto_sea_tile(state, nation_as, p, a)) {
+			return false;
+		}
+	}
+	return true;
+}
+
+static bool path_cache_lookup(sys::state& state, path_kind kind, dcon::province_id start, dcon::province_id end, dcon::nation_id access_class, dcon::army_id a, std::vector<dcon::province_id>& path_result) {
+	auto& cache = state.path_cache;
+	auto key = path_cache_key(kind, start, end, access_class);
+	{
+		std::lock_guard lg{ cache.lock };
+		auto it = cache.index.find(key);
+		if(it == cache.index.end()) {
+			cache.misses.fetch_add(1, std::memory_order_relaxed);
+			return false;
+		}
+		auto i = it->second;
+		auto& e = cache.entries[i];
+		if(e.global_epoch != cache.global_epoch || e.nation_epoch != nation_path_epoch(cache, access_class)) {
+			drop_path_entry(cache, i);
+			cache.stale_entries.fetch_add(1, std::memory_order_relaxed);
+			cache.misses.fetch_add(1, std::memory_order_relaxed);
+			return false;
+		}
+		path_result = e.path;
+		unlink_path_entry(cache, i);
+		link_path_entry_as_newest(cache, i);
+	}
+
+	if(!cached_path_is_usable(state, kind, path_result, access_class, a)) {
+		std::lock_guard lg{ cache.lock };
+		auto it = cache.index.find(key);
+		if(it != cache.index.end())
+			drop_path_entry(cache, it->second);
+		cache.stale_entries.fetch_add(1, std::memory_order_relaxed);
+		cache.misses.fetch_add(1, std::memory_order_relaxed);
+		path_result.clear();
+		return false;
+	}
+	cache.hits.fetch_add(1, std::memory_order_relaxed);
+	return true;
+}
+
+static void path_cache_insert(sys::state& state, path_kind kind, dcon::province_id start, dcon::province_id end, dcon::nation_id access_class, std::vector<dcon::province_id> const& path) {
+	auto& cache = state.path_cache;
+	auto key = path_cache_key(kind, start, end, access_class);
+	auto capacity = int32_t(state.defines.alice_path_cache_size);
+
+	std::lock_guard lg{ cache.lock };
+	int32_t i = -1;
+	if(auto it = cache.index.find(key); it != cache.index.end()) { // found by another thread in the meantime
+		i = it->second;
+		unlink_path_entry(cache, i);
+	} else if(int32_t(cache.entries.size()) < capacity) {
+		i = int32_t(cache.entries.size());
+		cache.entries.emplace_back();
+	} else {
+		i = cache.oldest;
+		if(cache.entries[i].key != 0)
+			cache.index.erase(cache.entries[i].key);
+		unlink_path_entry(cache, i);
+	}
+
+	auto& e = cache.entries[i];
+	e.key = key;
+	e.path.assign(path.begin(), path.end());
+	e.access_class = access_class;
+	e.global_epoch = cache.global_epoch;
+	e.nation_epoch = nation_path_epoch(cache, access_class);
+	cache.index.insert_or_assign(key, i);
+	link_path_entry_as_newest(cache, i);
+}
+
+void invalidate_path_cache(sys::state& state) {
+	auto& cache = state.path_cache;
+	std::lock_guard lg{ cache.lock };
+	++cache.global_epoch;
+	cache.invalidations.fetch_add(1, std::memory_order_relaxed);
+}
+
+void invalidate_path_cache(sys::state& state, dcon::nation_id n) {
+	if(!n)
+		return;
+	auto& cache = state.path_cache;
+	std::lock_guard lg{ cache.lock };
+	if(uint32_t(n.index()) >= cache.nation_epochs.size())
+		cache.nation_epochs.resize(state.world.nation_size(), 0);
+	if(uint32_t(n.index()) < cache.nation_epochs.size())
+		++cache.nation_epochs[n.index()];
+	cache.invalidations.fetch_add(1, std::memory_order_relaxed);
+}
+
+void report_path_cache_stats(sys::state& state) {
+	auto& cache = state.path_cache;
+	auto hits = cache.hits.exchange(0, std::memory_order_relaxed);
+	auto misses = cache.misses.exchange(0, std::memory_order_relaxed);
+	auto stale = cache.stale_entries.exchange(0, std::memory_order_relaxed);
+	auto invalidations = cache.invalidations.exchange(0, std::memory_order_relaxed);
+	if(!state.tick_profile.enabled.load(std::memory_order_relaxed))
+		return;
+	state.tick_profile.add_count("path_cache_hits", hits);
+	state.tick_profile.add_count("path_cache_misses", misses);
+	state.tick_profile.add_count("path_cache_stale_entries", stale);
+	state.tick_profile.add_count("path_cache_invalidations", invalidations);
+}
+
 static void assert_path_result(std::vector<dcon::province_id>& v) {
 	for(auto const e : v)
 		assert(bool(e));
 }
 
-// normal pathfinding
-std::vector<dcon::province_id> make_land_path(sys::state& state, dcon::province_id start, dcon::province_id end, dcon::nation_id nation_as, dcon::army_id a) {
+// normal pathfinding; when restricted to the corridor, land provinces outside of it are treated as inaccessible
+static void land_path_search(sys::state& state, path_workspace& workspace, dcon::province_id start, dcon::province_id end, dcon::nation_id nation_as, dcon::army_id a, bool corridor_only, std::vector<dcon::province_id>& path_result) {
+	auto& path_heap = workspace.heap;
+	auto& origins_vector = workspace.origins;
 
-	std::vector<province_and_distance> path_heap;
-	auto origins_vector = ve::vectorizable_buffer<dcon::province_id, dcon::province_id>(state.world.province_size());
-
-	std::vector<dcon::province_id> path_result;
+	path_result.clear();
 
 	if(start == end)
-		return path_result;
+		return;
 
 	auto fill_path_result = [&](dcon::province_id i) {
 		path_result.push_back(end);
@@ -1894,11 +2483,11 @@ std::vector<dcon::province_id> make_land_path(sys::state& state, dcon::province_
 				if(other_prov == end) {
 					fill_path_result(nearest.province);
 					assert_path_result(path_result);
-					return path_result;
+					return;
 				}
 
 				if(other_prov.id.index() < state.province_definitions.first_sea_province.index()) { // is land
-					if(has_access_to_province(state, nation_as, other_prov)) {
+					if((!corridor_only || in_region_corridor(state, workspace, other_prov)) && has_access_to_province(state, nation_as, other_prov)) {
 						/* This will work fine for most instances, except, possibly, for allied nations or enemy ones */
 						auto armies = state.world.province_get_army_location(other_prov);
 						float danger_factor = (armies.begin() == armies.end() || (*armies.begin()).get_army().get_controller_from_army_control() == nation_as) ? 1.f : 4.f;
@@ -1924,18 +2513,163 @@ std::vector<dcon::province_id> make_land_path(sys::state& state, dcon::province_
 	}
 
 	assert_path_result(path_result);
-	return path_result;
 }
 
-std::vector<dcon::province_id> make_safe_land_path(sys::state& state, dcon::province_id start, dcon::province_id end, dcon::nation_id nation_as) {
+static void find_land_path(sys::state& state, dcon::province_id start, dcon::province_id end, dcon::nation_id nation_as, dcon::army_id a, std::vector<dcon::province_id>& path_result) {
+	auto first_sea = state.province_definitions.first_sea_province.index();
+	auto min_distance = state.defines.alice_hierarchical_path_min_distance;
+	if(min_distance > 0.0f && start.index() < first_sea && end.index() < first_sea) {
+		auto direct = direct_distance(state, start, end);
+		if(direct >= min_distance) {
+			auto& workspace = begin_path_search(state);
+			if(find_region_corridor(state, workspace, start, end)) {
+				land_path_search(state, workspace, start, end, nation_as, a, true, path_result);
+				// no path can be shorter than the direct distance, so this bounds how far from optimal the accepted path is
+				if(!path_result.empty() && path_length(state, start, path_result) <= direct * state.defines.alice_hierarchical_path_bound)
+					return;
+			}
+		}
+	}
+
+	land_path_search(state, begin_path_search(state), start, end, nation_as, a, false, path_result);
+}
 
-	std::vector<province_and_distance> path_heap;
-	auto origins_vector = ve::vectorizable_buffer<dcon::province_id, dcon::province_id>(state.world.province_size());
+void make_land_path(sys::state& state, dcon::province_id start, dcon::province_id end, dcon::nation_id nation_as, dcon::army_id a, std::vector<dcon::province_id>& path_result) {
+	bool cached = start != end && path_cache_enabled(state);
+	if(cached && path_cache_lookup(state, path_kind::land, start, end, nation_as, a, path_result))
+		return;
+	find_land_path(state, start, end, nation_as, a, path_result);
+	if(cached && !path_result.empty())
+		path_cache_insert(state, path_kind::land, start, end, nation_as, path_result);
+}
 
+std::vector<dcon::province_id> make_land_path(sys::state& state, dcon::province_id start, dcon::province_id end, dcon::nation_id nation_as, dcon::army_id a) {
 	std::vector<dcon::province_id> path_result;
+	make_land_path(state, start, end, nation_as, a, path_result);
+	return path_result;
+}
+
+bool distance_field::reached(dcon::province_id p) const {
+	return generation != 0 && size_t(p.index()) < settled_stamps.size() && settled_stamps[p.index()] == generation;
+}
+
+float distance_field::distance_to(dcon::province_id p) const {
+	return reached(p) ? distances[p.index()] : std::numeric_limits<float>::infinity();
+}
+
+void distance_field::path_to(dcon::province_id p, std::vector<dcon::province_id>& path_result) const {
+	path_result.clear();
+	if(!reached(p))
+		return;
+	for(auto i = p; i != start; i = parents[i.index()]) {
+		path_result.push_back(i);
+	}
+}
+
+int32_t distance_field::begin_search(sys::state& state, dcon::province_id from, std::vector<dcon::province_id> const& targets) {
+	auto province_count = size_t(state.world.province_size());
+	if(distances.size() != province_count) {
+		distances.assign(province_count, 0.0f);
+		parents.assign(province_count, dcon::province_id{});
+		seen_stamps.assign(province_count, 0);
+		settled_stamps.assign(province_count, 0);
+		target_stamps.assign(province_count, 0);
+		generation = 0;
+	}
+	++generation;
+	if(generation == 0) { // the stamps wrapped around, so old ones could be mistaken for current ones
+		std::fill(seen_stamps.begin(), seen_stamps.end(), 0);
+		std::fill(settled_stamps.begin(), settled_stamps.end(), 0);
+		std::fill(target_stamps.begin(), target_stamps.end(), 0);
+		generation = 1;
+	}
+	start = from;
+	heap.clear();
+
+	int32_t distinct_targets = 0;
+	for(auto t : targets) {
+		if(t && target_stamps[t.index()] != generation) {
+			target_stamps[t.index()] = generation;
+			++distinct_targets;
+		}
+	}
+
+	distances[from.index()] = 0.0f;
+	parents[from.index()] = dcon::province_id{};
+	seen_stamps[from.index()] = generation;
+	heap.push_back(distance_field_entry{0.0f, from});
+	return distinct_targets;
+}
+
+int32_t find_land_distances(sys::state& state, dcon::province_id start, dcon::nation_id nation_as, dcon::army_id a, std::vector<dcon::province_id> const& targets, int32_t target_count, float distance_limit, distance_field& field) {
+	auto distinct_targets = field.begin_search(state, start, targets);
+	auto const generation = field.generation;
+	if(target_count <= 0 || target_count > distinct_targets)
+		target_count = distinct_targets;
+
+	auto first_sea = state.province_definitions.first_sea_province.index();
+	int32_t found = 0;
+
+	while(field.heap.size() > 0 && found < target_count) {
+		std::pop_heap(field.heap.begin(), field.heap.end());
+		auto nearest = field.heap.back();
+		field.heap.pop_back();
+
+		if(nearest.distance > distance_limit)
+			break; // everything left on the heap is at least this far
+		if(field.settled_stamps[nearest.province.index()] == generation)
+			continue; // a shorter way here was already taken
+		field.settled_stamps[nearest.province.index()] = generation;
+
+		if(field.target_stamps[nearest.province.index()] == generation) {
+			++found;
+			// targets are entered without access, like the end of make_land_path, but paths may not continue through them
+			if(nearest.province != start && nearest.province.index() < first_sea && !has_access_to_province(state, nation_as, nearest.province))
+				continue;
+		}
+
+		for(auto adj : state.world.province_get_province_adjacency(nearest.province)) {
+			auto other_prov =
+					adj.get_connected_provinces(0) == nearest.province ? adj.get_connected_provinces(1) : adj.get_connected_provinces(0);
+			auto bits = adj.get_type();
+			if((bits & province::border::impassible_bit) != 0 || field.settled_stamps[other_prov.id.index()] == generation)
+				continue;
+
+			float cost = adj.get_distance();
+			if(other_prov.id.index() < first_sea) { // is land
+				if(field.target_stamps[other_prov.id.index()] != generation && !has_access_to_province(state, nation_as, other_prov))
+					continue;
+				auto armies = state.world.province_get_army_location(other_prov);
+				float danger_factor = (armies.begin() == armies.end() || (*armies.begin()).get_army().get_controller_from_army_control() == nation_as) ? 1.f : 4.f;
+				cost *= danger_factor;
+			} else { // is sea
+				if(!a || !military::can_embark_onto_sea_tile(state, nation_as, other_prov, a))
+					continue;
+			}
+
+			auto candidate = nearest.distance + cost;
+			if(field.seen_stamps[other_prov.id.index()] != generation || candidate < field.distances[other_prov.id.index()]) {
+				field.seen_stamps[other_prov.id.index()] = generation;
+				field.distances[other_prov.id.index()] = candidate;
+				field.parents[other_prov.id.index()] = nearest.province;
+				field.heap.push_back(distance_field_entry{candidate, other_prov});
+				std::push_heap(field.heap.begin(), field.heap.end());
+			}
+		}
+	}
+	return found;
+}
+
+void make_safe_land_path(sys::state& state, dcon::province_id start, dcon::province_id end, dcon::nation_id nation_as, std::vector<dcon::province_id>& path_result) {
+
+	auto& workspace = begin_path_search(state);
+	auto& path_heap = workspace.heap;
+	auto& origins_vector = workspace.origins;
+
+	path_result.clear();
 
 	if(start == end)
-		return path_result;
+		return;
 
 	auto fill_path_result = [&](dcon::province_id i) {
 		path_result.push_back(end);
@@ -1961,7 +2695,7 @@ std::vector<dcon::province_id> make_safe_land_path(sys::state& state, dcon::prov
 				if(other_prov == end) {
 					fill_path_result(nearest.province);
 					assert_path_result(path_result);
-					return path_result;
+					return;
 				}
 
 				if(other_prov.id.index() < state.province_definitions.first_sea_province.index()) { // is land
@@ -1981,18 +2715,24 @@ std::vector<dcon::province_id> make_safe_land_path(sys::state& state, dcon::prov
 	}
 
 	assert_path_result(path_result);
+}
+
+std::vector<dcon::province_id> make_safe_land_path(sys::state& state, dcon::province_id start, dcon::province_id end, dcon::nation_id nation_as) {
+	std::vector<dcon::province_id> path_result;
+	make_safe_land_path(state, start, end, nation_as, path_result);
 	return path_result;
 }
 
 // used for land trade
-std::vector<dcon::province_id> make_unowned_path(sys::state& state, dcon::province_id start, dcon::province_id end) {
-	std::vector<province_and_distance> path_heap;
-	auto origins_vector = ve::vectorizable_buffer<dcon::province_id, dcon::province_id>(state.world.province_size());
+void make_unowned_path(sys::state& state, dcon::province_id start, dcon::province_id end, std::vector<dcon::province_id>& path_result) {
+	auto& workspace = begin_path_search(state);
+	auto& path_heap = workspace.heap;
+	auto& origins_vector = workspace.origins;
 
-	std::vector<dcon::province_id> path_result;
+	path_result.clear();
 
 	if(start == end)
-		return path_result;
+		return;
 
 	auto fill_path_result = [&](dcon::province_id i) {
 		path_result.push_back(end);
@@ -2026,7 +2766,7 @@ std::vector<dcon::province_id> make_unowned_path(sys::state& state, dcon::provin
 				if(other_prov == end) {
 					fill_path_result(nearest.province);
 					assert_path_result(path_result);
-					return path_result;
+					return;
 				}
 				path_heap.push_back(
 						province_and_distance{ nearest.distance_covered + distance, direct_distance(state, other_prov, end), other_prov });
@@ -2037,18 +2777,24 @@ std::vector<dcon::province_id> make_unowned_path(sys::state& state, dcon::provin
 	}
 
 	assert_path_result(path_result);
+}
+
+std::vector<dcon::province_id> make_unowned_path(sys::state& state, dcon::province_id start, dcon::province_id end) {
+	std::vector<dcon::province_id> path_result;
+	make_unowned_path(state, start, end, path_result);
 	return path_result;
 }
 
 // used for rebel unit and black-flagged unit pathfinding
-std::vector<dcon::province_id> make_unowned_land_path(sys::state& state, dcon::province_id start, dcon::province_id end) {
-	std::vector<province_and_distance> path_heap;
-	auto origins_vector = ve::vectorizable_buffer<dcon::province_id, dcon::province_id>(state.world.province_size());
+void make_unowned_land_path(sys::state& state, dcon::province_id start, dcon::province_id end, std::vector<dcon::province_id>& path_result) {
+	auto& workspace = begin_path_search(state);
+	auto& path_heap = workspace.heap;
+	auto& origins_vector = workspace.origins;
 
-	std::vector<dcon::province_id> path_result;
+	path_result.clear();
 
 	if(start == end)
-		return path_result;
+		return;
 
 	auto fill_path_result = [&](dcon::province_id i) {
 		path_result.push_back(end);
@@ -2074,7 +2820,7 @@ std::vector<dcon::province_id> make_unowned_land_path(sys::state& state, dcon::p
 				if(other_prov == end) {
 					fill_path_result(nearest.province);
 					assert_path_result(path_result);
-					return path_result;
+					return;
 				}
 				if((bits & province::border::coastal_bit) == 0) { // doesn't cross coast -- i.e. is land province
 					path_heap.push_back(
@@ -2087,19 +2833,25 @@ std::vector<dcon::province_id> make_unowned_land_path(sys::state& state, dcon::p
 	}
 
 	assert_path_result(path_result);
+}
+
+std::vector<dcon::province_id> make_unowned_land_path(sys::state& state, dcon::province_id start, dcon::province_id end) {
+	std::vector<dcon::province_id> path_result;
+	make_unowned_land_path(state, start, end, path_result);
 	return path_result;
 }
 
 // naval unit pathfinding; start and end provinces may be land provinces; function assumes you have naval access to both
-std::vector<dcon::province_id> make_naval_path(sys::state& state, dcon::province_id start, dcon::province_id end) {
+static void find_naval_path(sys::state& state, dcon::province_id start, dcon::province_id end, std::vector<dcon::province_id>& path_result) {
 
-	std::vector<province_and_distance> path_heap;
-	auto origins_vector = ve::vectorizable_buffer<dcon::province_id, dcon::province_id>(state.world.province_size());
+	auto& workspace = begin_path_search(state);
+	auto& path_heap = workspace.heap;
+	auto& origins_vector = workspace.origins;
 
-	std::vector<dcon::province_id> path_result;
+	path_result.clear();
 
 	if(start == end)
-		return path_result;
+		return;
 
 	auto fill_path_result = [&](dcon::province_id i) {
 		path_result.push_back(end);
@@ -2132,7 +2884,7 @@ std::vector<dcon::province_id> make_naval_path(sys::state& state, dcon::province
 					if(other_prov == end) {
 						fill_path_result(nearest.province);
 						assert_path_result(path_result);
-						return path_result;
+						return;
 					} else {
 
 						path_heap.push_back(province_and_distance{ nearest.distance_covered + distance, direct_distance(state, other_prov, end), other_prov });
@@ -2143,13 +2895,13 @@ std::vector<dcon::province_id> make_naval_path(sys::state& state, dcon::province
 
 					fill_path_result(nearest.province);
 					assert_path_result(path_result);
-					return path_result;
+					return;
 				} else if(nearest.province.index() < state.province_definitions.first_sea_province.index() && state.world.province_get_port_to(nearest.province) == other_prov.id) { // case: leaving port
 
 					if(other_prov == end) {
 						fill_path_result(nearest.province);
 						assert_path_result(path_result);
-						return path_result;
+						return;
 					} else {
 						path_heap.push_back(province_and_distance{ nearest.distance_covered + distance, direct_distance(state, other_prov, end), other_prov });
 						std::push_heap(path_heap.begin(), path_heap.end());
@@ -2161,26 +2913,30 @@ std::vector<dcon::province_id> make_naval_path(sys::state& state, dcon::province
 	}
 
 	assert_path_result(path_result);
-	return path_result;
 }
 
-struct retreat_province_and_distance {
-	float distance_covered = 0.0f;
-	dcon::province_id province;
+void make_naval_path(sys::state& state, dcon::province_id start, dcon::province_id end, std::vector<dcon::province_id>& path_result) {
+	bool cached = start != end && path_cache_enabled(state);
+	if(cached && path_cache_lookup(state, path_kind::naval, start, end, dcon::nation_id{ }, dcon::army_id{ }, path_result))
+		return;
+	find_naval_path(state, start, end, path_result);
+	if(cached && !path_result.empty())
+		path_cache_insert(state, path_kind::naval, start, end, dcon::nation_id{ }, path_result);
+}
 
-	bool operator<(retreat_province_and_distance const& other) const noexcept {
-		if(other.distance_covered != distance_covered)
-			return distance_covered > other.distance_covered;
-		return other.province.index() > province.index();
-	}
-};
+std::vector<dcon::province_id> make_naval_path(sys::state& state, dcon::province_id start, dcon::province_id end) {
+	std::vector<dcon::province_id> path_result;
+	make_naval_path(state, start, end, path_result);
+	return path_result;
+}
 
-std::vector<dcon::province_id> make_naval_retreat_path(sys::state& state, dcon::nation_id nation_as, dcon::province_id start) {
+void make_naval_retreat_path(sys::state& state, dcon::nation_id nation_as, dcon::province_id start, std::vector<dcon::province_id>& path_result) {
 
-	std::vector<retreat_province_and_distance> path_heap;
-	auto origins_vector = ve::vectorizable_buffer<dcon::province_id, dcon::province_id>(state.world.province_size());
+	auto& workspace = begin_path_search(state);
+	auto& path_heap = workspace.retreat_heap;
+	auto& origins_vector = workspace.origins;
 
-	std::vector<dcon::province_id> path_result;
+	path_result.clear();
 
 	auto fill_path_result = [&](dcon::province_id i) {
 		while(i && i != start) {
@@ -2198,7 +2954,7 @@ std::vector<dcon::province_id> make_naval_retreat_path(sys::state& state, dcon::
 		if(nearest.province.index() < state.province_definitions.first_sea_province.index()) {
 			fill_path_result(nearest.province);
 			assert_path_result(path_result);
-			return path_result;
+			return;
 		}
 
 		for(auto adj : state.world.province_get_province_adjacency(nearest.province)) {
@@ -2226,17 +2982,23 @@ std::vector<dcon::province_id> make_naval_retreat_path(sys::state& state, dcon::
 	}
 
 	assert_path_result(path_result);
+}
+
+std::vector<dcon::province_id> make_naval_retreat_path(sys::state& state, dcon::nation_id nation_as, dcon::province_id start) {
+	std::vector<dcon::province_id> path_result;
+	make_naval_retreat_path(state, nation_as, start, path_result);
 	return path_result;
 }
 
-std::vector<dcon::province_id> make_land_retreat_path(sys::state& state, dcon::nation_id nation_as, dcon::province_id start) {
+void make_land_retreat_path(sys::state& state, dcon::nation_id nation_as, dcon::province_id start, std::vector<dcon::province_id>& path_result) {
 
-	std::vector<retreat_province_and_distance> path_heap;
-	auto origins_vector = ve::vectorizable_buffer<dcon::province_id, dcon::province_id>(state.world.province_size());
+	auto& workspace = begin_path_search(state);
+	auto& path_heap = workspace.retreat_heap;
+	auto& origins_vector = workspace.origins;
 
 	origins_vector.set(start, dcon::province_id{0});
 
-	std::vector<dcon::province_id> path_result;
+	path_result.clear();
 
 	auto fill_path_result = [&](dcon::province_id i) {
 		while(i && i != start) {
@@ -2254,7 +3016,7 @@ std::vector<dcon::province_id> make_land_retreat_path(sys::state& state, dcon::n
 		if(nearest.province != start && has_naval_access_to_province(state, nation_as, nearest.province)) {
 			fill_path_result(nearest.province);
 			assert_path_result(path_result);
-			return path_result;
+			return;
 		}
 
 		for(auto adj : state.world.province_get_province_adjacency(nearest.province)) {
@@ -2276,16 +3038,22 @@ std::vector<dcon::province_id> make_land_retreat_path(sys::state& state, dcon::n
 	}
 
 	assert_path_result(path_result);
+}
+
+std::vector<dcon::province_id> make_land_retreat_path(sys::state& state, dcon::nation_id nation_as, dcon::province_id start) {
+	std::vector<dcon::province_id> path_result;
+	make_land_retreat_path(state, nation_as, start, path_result);
 	return path_result;
 }
 
-std::vector<dcon::province_id> make_path_to_nearest_coast(sys::state& state, dcon::nation_id nation_as, dcon::province_id start) {
-	std::vector<retreat_province_and_distance> path_heap;
-	auto origins_vector = ve::vectorizable_buffer<dcon::province_id, dcon::province_id>(state.world.province_size());
+void make_path_to_nearest_coast(sys::state& state, dcon::nation_id nation_as, dcon::province_id start, std::vector<dcon::province_id>& path_result) {
+	auto& workspace = begin_path_search(state);
+	auto& path_heap = workspace.retreat_heap;
+	auto& origins_vector = workspace.origins;
 
 	origins_vector.set(start, dcon::province_id{0});
 
-	std::vector<dcon::province_id> path_result;
+	path_result.clear();
 
 	auto fill_path_result = [&](dcon::province_id i) {
 		while(i && i != start) {
@@ -2303,7 +3071,7 @@ std::vector<dcon::province_id> make_path_to_nearest_coast(sys::state& state, dco
 		if(state.world.province_get_is_coast(nearest.province)) {
 			fill_path_result(nearest.province);
 			assert_path_result(path_result);
-			return path_result;
+			return;
 		}
 
 		for(auto adj : state.world.province_get_province_adjacency(nearest.province)) {
@@ -2329,15 +3097,21 @@ std::vector<dcon::province_id> make_path_to_nearest_coast(sys::state& state, dco
 	}
 
 	assert_path_result(path_result);
+}
+
+std::vector<dcon::province_id> make_path_to_nearest_coast(sys::state& state, dcon::nation_id nation_as, dcon::province_id start) {
+	std::vector<dcon::province_id> path_result;
+	make_path_to_nearest_coast(state, nation_as, start, path_result);
 	return path_result;
 }
-std::vector<dcon::province_id> make_unowned_path_to_nearest_coast(sys::state& state, dcon::province_id start) {
-	std::vector<retreat_province_and_distance> path_heap;
-	auto origins_vector = ve::vectorizable_buffer<dcon::province_id, dcon::province_id>(state.world.province_size());
+void make_unowned_path_to_nearest_coast(sys::state& state, dcon::province_id start, std::vector<dcon::province_id>& path_result) {
+	auto& workspace = begin_path_search(state);
+	auto& path_heap = workspace.retreat_heap;
+	auto& origins_vector = workspace.origins;
 
 	origins_vector.set(start, dcon::province_id{0});
 
-	std::vector<dcon::province_id> path_result;
+	path_result.clear();
 
 	auto fill_path_result = [&](dcon::province_id i) {
 		while(i && i != start) {
@@ -2355,7 +3129,7 @@ std::vector<dcon::province_id> make_unowned_path_to_nearest_coast(sys::state& st
 		if(state.world.province_get_is_coast(nearest.province)) {
 			fill_path_result(nearest.province);
 			assert_path_result(path_result);
-			return path_result;
+			return;
 		}
 
 		for(auto adj : state.world.province_get_province_adjacency(nearest.province)) {
@@ -2377,6 +3151,11 @@ std::vector<dcon::province_id> make_unowned_path_to_nearest_coast(sys::state& st
 	}
 
 	assert_path_result(path_result);
+}
+
+std::vector<dcon::province_id> make_unowned_path_to_nearest_coast(sys::state& state, dcon::province_id start) {
+	std::vector<dcon::province_id> path_result;
+	make_unowned_path_to_nearest_coast(state, start, path_result);
 	return path_result;
 }
 
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <atomic>
+#include <mutex>
 #include "dcon_generated.hpp"
 #include "constants.hpp"
 
@@ -17,12 +19,35 @@ inline constexpr dcon::province_id from_map_id(uint16_t id) {
 		return dcon::province_id(id - 1);
 }
 
+// link between two adjacent state definitions in the abstract graph used for long distance land pathfinding
+struct region_link {
+	dcon::state_definition_id to;
+	float distance = 0.0f; // between the centers of the two regions
+};
+
+struct province_owner_change {
+	dcon::province_id province;
+	dcon::nation_id old_owner; // before the first change since the connected regions were last updated
+};
+
 struct global_provincial_state {
 	std::vector<dcon::province_adjacency_id> canals;
 	std::vector<dcon::province_id> canal_provinces;
 	ankerl::unordered_dense::map<dcon::modifier_id, dcon::gfx_object_id, sys::modifier_hash> terrain_to_gfx_map;
 	std::vector<bool> connected_region_is_coastal;
 
+	// ownership changes not yet applied to the connected regions, coasts and nation adjacency; update_connected_regions applies
+	// them locally when the regions are valid, and otherwise rebuilds everything. Region and coast ids are only meant to be compared
+	// for equality: the local update keeps the ids of the regions it does not touch, so ids are not dense
+	std::vector<province_owner_change> pending_owner_changes;
+	bool connected_regions_valid = false;
+
+	// abstract graph with one node per state definition, rebuilt by build_region_graph; the links of state definition i are
+	// region_links[region_link_offsets[i]] .. region_links[region_link_offsets[i + 1] - 1]
+	std::vector<region_link> region_links;
+	std::vector<uint32_t> region_link_offsets;
+	std::vector<dcon::province_id> region_centers;
+
 	dcon::province_id first_sea_province;
 	dcon::modifier_id europe;
 	dcon::modifier_id asia;
@@ -32,12 +57,55 @@ struct global_provincial_state {
 	dcon::modifier_id oceania;
 };
 
+enum class path_kind : uint8_t { land, naval };
+
+struct path_cache_entry {
+	uint64_t key = 0;
+	std::vector<dcon::province_id> path;
+	dcon::nation_id access_class;
+	uint32_t global_epoch = 0;
+	uint32_t nation_epoch = 0;
+	int32_t newer = -1;
+	int32_t older = -1;
+};
+
+//
+// Bounded least recently used cache of the paths found by make_land_path and make_naval_path, keyed by start, end, kind of path
+// and access class: the nation whose military access, wars and transports the path was found with. A hit is only used after
+// checking that the nation can still enter every province of the path (and embark onto its sea tiles); otherwise the entry is
+// dropped. Events that may open better paths invalidate, through per nation and global epochs, the entries of the nations they
+// concern. Only used in single player, as which searches hit depends on the timing of the threads of the ai
+//
+struct path_cache {
+	std::mutex lock;
+	std::vector<path_cache_entry> entries;
+	ankerl::unordered_dense::map<uint64_t, int32_t> index;
+	int32_t newest = -1;
+	int32_t oldest = -1;
+	uint32_t global_epoch = 0;
+	std::vector<uint32_t> nation_epochs;
+
+	std::atomic<int64_t> hits = 0;
+	std::atomic<int64_t> misses = 0;
+	std::atomic<int64_t> stale_entries = 0;
+	std::atomic<int64_t> invalidations = 0;
+};
+
+// drops every cached path
+void invalidate_path_cache(sys::state& state);
+// drops the cached paths found with the access rights of a nation
+void invalidate_path_cache(sys::state& state, dcon::nation_id n);
+// adds the path cache counters of the day to the tick profiler
+void report_path_cache_stats(sys::state& state);
+
 bool nations_are_adjacent(sys::state& state, dcon::nation_id a, dcon::nation_id b);
+// brings the connected regions, connected coasts and nation adjacency up to date with the ownership changes since the last call
 void update_connected_regions(sys::state& state);
 void update_cached_values(sys::state& state);
 void update_blockaded_cache(sys::state& state);
 void restore_unsaved_values(sys::state& state);
 void restore_distances(sys::state& state);
+void build_region_graph(sys::state& state);
 
 bool is_overseas(sys::state const& state, dcon::province_id ids);
 bool can_integrate_colony(sys::state& state, dcon::state_instance_id id);
@@ -117,7 +185,8 @@ bool has_safe_access_to_province(sys::state& state, dcon::nation_id nation_as, d
 // when pathfinding, check that the destination province is valid on its own (i.e. accessible for normal, or embark-able for sea)
 //
 
-// normal pathfinding
+// normal pathfinding; long paths between land provinces are first searched inside a corridor of state definitions found on the
+// region graph, and only searched on the whole map when that fails or gives a path much longer than the direct distance
 std::vector<dcon::province_id> make_land_path(sys::state& state, dcon::province_id start, dcon::province_id end, dcon::nation_id nation_as, dcon::army_id a);
 // pathfind through non-enemy controlled, not under siege provinces
 std::vector<dcon::province_id> make_safe_land_path(sys::state& state, dcon::province_id start, dcon::province_id end, dcon::nation_id nation_as);
@@ -133,6 +202,64 @@ std::vector<dcon::province_id> make_land_retreat_path(sys::state& state, dcon::n
 std::vector<dcon::province_id> make_path_to_nearest_coast(sys::state& state, dcon::nation_id nation_as, dcon::province_id start);
 std::vector<dcon::province_id> make_unowned_path_to_nearest_coast(sys::state& state, dcon::province_id start);
 
+//
+// the same searches, writing the path into path_result (which is cleared first) instead of returning a new vector; call these with a
+// buffer that outlives the loop when pathfinding repeatedly. All the pathfinding functions reuse per thread search buffers, so they
+// may be called concurrently from different threads
+//
+void make_land_path(sys::state& state, dcon::province_id start, dcon::province_id end, dcon::nation_id nation_as, dcon::army_id a, std::vector<dcon::province_id>& path_result);
+void make_safe_land_path(sys::state& state, dcon::province_id start, dcon::province_id end, dcon::nation_id nation_as, std::vector<dcon::province_id>& path_result);
+void make_unowned_path(sys::state& state, dcon::province_id start, dcon::province_id end, std::vector<dcon::province_id>& path_result);
+void make_unowned_land_path(sys::state& state, dcon::province_id start, dcon::province_id end, std::vector<dcon::province_id>& path_result);
+void make_naval_path(sys::state& state, dcon::province_id start, dcon::province_id end, std::vector<dcon::province_id>& path_result);
+void make_naval_retreat_path(sys::state& state, dcon::nation_id nation_as, dcon::province_id start, std::vector<dcon::province_id>& path_result);
+void make_land_retreat_path(sys::state& state, dcon::nation_id nation_as, dcon::province_id start, std::vector<dcon::province_id>& path_result);
+void make_path_to_nearest_coast(sys::state& state, dcon::nation_id nation_as, dcon::province_id start, std::vector<dcon::province_id>& path_result);
+void make_unowned_path_to_nearest_coast(sys::state& state, dcon::province_id start, std::vector<dcon::province_id>& path_result);
+
+//
+// one to many land pathfinding, for choosing among many destinations by how far they actually are from one province. The distances
+// and the parent of every province settled by the search are kept in the field, which should be reused between searches: its
+// entries are stamped with the search that wrote them, so it is only cleared when the number of provinces changes
+//
+struct distance_field_entry {
+	float distance = 0.0f;
+	dcon::province_id province;
+
+	bool operator<(distance_field_entry const& other) const noexcept {
+		if(other.distance != distance)
+			return distance > other.distance;
+		return other.province.index() > province.index();
+	}
+};
+
+struct distance_field {
+	std::vector<float> distances;
+	std::vector<dcon::province_id> parents;
+	std::vector<uint32_t> seen_stamps;
+	std::vector<uint32_t> settled_stamps;
+	std::vector<uint32_t> target_stamps;
+	std::vector<distance_field_entry> heap;
+	dcon::province_id start;
+	uint32_t generation = 0;
+
+	// starts a new search from start with the given targets: resizes the field if the number of provinces changed, stamps the
+	// targets and puts start on the heap. Returns the number of distinct targets
+	int32_t begin_search(sys::state& state, dcon::province_id from, std::vector<dcon::province_id> const& targets);
+	// whether the last search found the shortest path to the province
+	bool reached(dcon::province_id p) const;
+	// length of that path, weighted like make_land_path weighs it; infinity for provinces that were not reached
+	float distance_to(dcon::province_id p) const;
+	// the path to a reached province, in the same order as make_land_path returns it (destination first, start excluded)
+	void path_to(dcon::province_id p, std::vector<dcon::province_id>& path_result) const;
+};
+
+// searches outwards from start through the provinces make_land_path would use for the army (sea tiles only for a valid army that
+// can embark onto them), and stops once target_count of the targets have been reached, or all of them when target_count is zero
+// or less, or once every province within distance_limit has been settled. As with make_land_path, targets themselves are entered
+// without checking access. Returns how many targets were reached
+int32_t find_land_distances(sys::state& state, dcon::province_id start, dcon::nation_id nation_as, dcon::army_id a, std::vector<dcon::province_id> const& targets, int32_t target_count, float distance_limit, distance_field& field);
+
 void set_province_controller(sys::state& state, dcon::province_id p, dcon::nation_id n);
 void set_province_controller(sys::state& state, dcon::province_id p, dcon::rebel_faction_id rf);
 
@@ -2045,10 +2045,12 @@ uint32_t ef_change_tag_no_core_switch_culture(EFFECT_PARAMTERS) {
 }
 uint32_t ef_set_country_flag(EFFECT_PARAMTERS) {
 	ws.world.nation_set_flag_variables(trigger::to_nation(primary_slot), trigger::payload(tval[1]).natf_id, true);
+	event::note_flags_changed(ws, trigger::to_nation(primary_slot));
 	return 0;
 }
 uint32_t ef_clr_country_flag(EFFECT_PARAMTERS) {
 	ws.world.nation_set_flag_variables(trigger::to_nation(primary_slot), trigger::payload(tval[1]).natf_id, false);
+	event::note_flags_changed(ws, trigger::to_nation(primary_slot));
 	return 0;
 }
 uint32_t ef_military_access(EFFECT_PARAMTERS) {
@@ -2760,6 +2762,7 @@ uint32_t ef_release_vassal(EFFECT_PARAMTERS) {
 		if(ws.world.nation_get_owned_province_count(holder) == 0)
 			return 0;
 		ws.world.force_create_overlord(holder, trigger::to_nation(primary_slot));
+		province::invalidate_path_cache(ws, trigger::to_nation(primary_slot));
 		if(ws.world.nation_get_is_great_power(trigger::to_nation(primary_slot))) {
 			auto sr = ws.world.force_create_gp_relationship(holder, trigger::to_nation(primary_slot));
 			auto& flags = ws.world.gp_relationship_get_status(sr);
@@ -2782,6 +2785,7 @@ uint32_t ef_release_vassal_this_nation(EFFECT_PARAMTERS) {
 		if(ws.world.nation_get_owned_province_count(trigger::to_nation(this_slot)) == 0)
 			return 0;
 		ws.world.force_create_overlord(trigger::to_nation(this_slot), trigger::to_nation(primary_slot));
+		province::invalidate_path_cache(ws, trigger::to_nation(primary_slot));
 		if(ws.world.nation_get_is_great_power(trigger::to_nation(primary_slot))) {
 			auto sr = ws.world.force_create_gp_relationship(trigger::to_nation(this_slot), trigger::to_nation(primary_slot));
 			auto& flags = ws.world.gp_relationship_get_status(sr);
@@ -2807,6 +2811,7 @@ uint32_t ef_release_vassal_this_province(EFFECT_PARAMTERS) {
 		if(ws.world.nation_get_owned_province_count(holder) == 0)
 			return 0;
 		ws.world.force_create_overlord(holder, trigger::to_nation(primary_slot));
+		province::invalidate_path_cache(ws, trigger::to_nation(primary_slot));
 		if(ws.world.nation_get_is_great_power(trigger::to_nation(primary_slot))) {
 			auto sr = ws.world.force_create_gp_relationship(holder, trigger::to_nation(primary_slot));
 			auto& flags = ws.world.gp_relationship_get_status(sr);
@@ -2829,6 +2834,7 @@ uint32_t ef_release_vassal_from_nation(EFFECT_PARAMTERS) {
 		if(ws.world.nation_get_owned_province_count(trigger::to_nation(from_slot)) == 0)
 			return 0;
 		ws.world.force_create_overlord(trigger::to_nation(from_slot), trigger::to_nation(primary_slot));
+		province::invalidate_path_cache(ws, trigger::to_nation(primary_slot));
 		if(ws.world.nation_get_is_great_power(trigger::to_nation(primary_slot))) {
 			auto sr = ws.world.force_create_gp_relationship(trigger::to_nation(from_slot), trigger::to_nation(primary_slot));
 			auto& flags = ws.world.gp_relationship_get_status(sr);
@@ -2854,6 +2860,7 @@ uint32_t ef_release_vassal_from_province(EFFECT_PARAMTERS) {
 		if(ws.world.nation_get_owned_province_count(holder) == 0)
 			return 0;
 		ws.world.force_create_overlord(holder, trigger::to_nation(primary_slot));
+		province::invalidate_path_cache(ws, trigger::to_nation(primary_slot));
 		if(ws.world.nation_get_is_great_power(trigger::to_nation(primary_slot))) {
 			auto sr = ws.world.force_create_gp_relationship(holder, trigger::to_nation(primary_slot));
 			auto& flags = ws.world.gp_relationship_get_status(sr);
@@ -2879,6 +2886,7 @@ uint32_t ef_release_vassal_reb(EFFECT_PARAMTERS) {
 		if(ws.world.nation_get_owned_province_count(holder) == 0)
 			return 0;
 		ws.world.force_create_overlord(holder, trigger::to_nation(primary_slot));
+		province::invalidate_path_cache(ws, trigger::to_nation(primary_slot));
 		if(ws.world.nation_get_is_great_power(trigger::to_nation(primary_slot))) {
 			auto sr = ws.world.force_create_gp_relationship(holder, trigger::to_nation(primary_slot));
 			auto& flags = ws.world.gp_relationship_get_status(sr);
@@ -4353,6 +4361,7 @@ uint32_t ef_set_variable(EFFECT_PARAMTERS) {
 	assert(std::isfinite(amount));
 
 	ws.world.nation_get_variables(trigger::to_nation(primary_slot), trigger::payload(tval[1]).natv_id) = amount;
+	event::note_flags_changed(ws, trigger::to_nation(primary_slot));
 	return 0;
 }
 uint32_t ef_change_variable(EFFECT_PARAMTERS) {
@@ -4360,6 +4369,7 @@ uint32_t ef_change_variable(EFFECT_PARAMTERS) {
 	assert(std::isfinite(amount));
 
 	ws.world.nation_get_variables(trigger::to_nation(primary_slot), trigger::payload(tval[1]).natv_id) += amount;
+	event::note_flags_changed(ws, trigger::to_nation(primary_slot));
 	return 0;
 }
 uint32_t ef_ideology(EFFECT_PARAMTERS) {
@@ -5412,6 +5422,7 @@ uint32_t internal_execute_effect(EFFECT_PARAMTERS) {
 
 void execute(sys::state& state, dcon::effect_key key, int32_t primary, int32_t this_slot, int32_t from_slot, uint32_t r_lo,
 		uint32_t r_hi) {
+	sys::script_profile_scope profile{ state.script_profile, sys::script_kind::effect, key.index(), 1 };
 	bool els = false;
 	internal_execute_effect(state.effect_data.data() + state.effect_data_indices[key.index() + 1], state, primary, this_slot, from_slot, r_lo, r_hi, els);
 }
@@ -514,19 +514,204 @@ void update_future_events(sys::state& state) {
 	}
 }
 
+//
+// The triggers and mtth modifiers of free events are also compiled to native code when the jit is available (see
+// state::on_scenario_load). The compiled functions take a single nation or province, so they are called lane by lane, and only
+// for the lanes that passed the ownership test. Until the functions are ready (or when the jit is not available) the
+// interpreter is used instead
+//
+
+template<typename TAG>
+ve::mask_vector jit_event_trigger(sys::state& state, uint64_t fn_address, dcon::trigger_key t, TAG ids, ve::mask_vector candidates) {
+	using ftype = float(*)(int32_t);
+	ftype fn = (ftype)fn_address;
+	auto values = ve::apply([&](auto id, bool candidate) {
+		if(!candidate)
+			return 0.0f;
+		float jit_result = fn(id.index());
+		if(state.jit_compare_mode.load(std::memory_order_relaxed)) {
+			state.record_jit_comparison(jit_result, trigger::evaluate(state, t, trigger::to_generic(id), trigger::to_generic(id), 0) ? 1.0f : 0.0f);
+		}
+		return jit_result;
+	}, ids, candidates);
+	return values != 0.0f;
+}
+
+template<typename TAG>
+ve::fp_vector jit_event_mtth(sys::state& state, uint64_t fn_address, dcon::value_modifier_key mod, TAG ids, ve::mask_vector candidates) {
+	using ftype = float(*)(int32_t);
+	ftype fn = (ftype)fn_address;
+	return ve::apply([&](auto id, bool candidate) {
+		if(!candidate)
+			return 1.0f;
+		float jit_result = fn(id.index());
+		if(state.jit_compare_mode.load(std::memory_order_relaxed)) {
+			state.record_jit_comparison(jit_result, trigger::evaluate_multiplicative_modifier(state, mod, trigger::to_generic(id), trigger::to_generic(id), 0));
+		}
+		return jit_result;
+	}, ids, candidates);
+}
+
+bool free_event_trigger_holds(sys::state& state, dcon::free_national_event_id e, dcon::nation_id n) {
+	auto t = state.world.free_national_event_get_trigger(e);
+	if(auto fn = state.world.free_national_event_get_trigger_fn(e); fn != 0 && t) {
+		using ftype = float(*)(int32_t);
+		return ((ftype)fn)(n.index()) != 0.0f;
+	}
+	return trigger::evaluate(state, t, trigger::to_generic(n), trigger::to_generic(n), 0);
+}
+bool free_event_trigger_holds(sys::state& state, dcon::free_provincial_event_id e, dcon::province_id p) {
+	auto t = state.world.free_provincial_event_get_trigger(e);
+	if(auto fn = state.world.free_provincial_event_get_trigger_fn(e); fn != 0 && t) {
+		using ftype = float(*)(int32_t);
+		return ((ftype)fn)(p.index()) != 0.0f;
+	}
+	return trigger::evaluate(state, t, trigger::to_generic(p), trigger::to_generic(p), 0);
+}
+
+//
+// Event trigger guards: the members of an event trigger that only read global flags and, for national events, the flags and
+// variables of the nation itself. Those are the values with change epochs: global_flag_epoch counts changes to the global flags
+// and the flag_epoch of a nation counts changes to its flags and variables
+//
+
+bool reads_only_tracked_values(uint16_t const* data, bool national) {
+	auto const code = data[0] & trigger::code_mask;
+	if(code == trigger::generic_scope) {
+		auto const source_size = 1 + trigger::get_trigger_scope_payload_size(data);
+		for(auto sub = data + 2; sub < data + source_size; sub += 1 + trigger::get_trigger_payload_size(sub)) {
+			if(!reads_only_tracked_values(sub, national))
+				return false;
+		}
+		return true;
+	}
+	if(code == trigger::has_global_flag)
+		return true;
+	if(national && (code == trigger::has_country_flag || code == trigger::check_variable))
+		return true;
+	return false;
+}
+
+void build_trigger_guard(sys::state& state, dcon::trigger_key t, bool national, event_trigger_guard& guard, uint32_t entity_count) {
+	guard.data.clear();
+	guard.known_false_at.clear();
+	if(!t)
+		return;
+
+	auto const start = state.optimized_trigger_data.data() + state.optimized_trigger_data_indices[t.index() + 1];
+	if(reads_only_tracked_values(start, national)) {
+		guard.data.assign(start, start + 1 + trigger::get_trigger_payload_size(start));
+	} else if(start[0] == trigger::generic_scope) { // a conjunction: it is false whenever the tracked members are
+		auto const source_size = 1 + trigger::get_trigger_scope_payload_size(start);
+		for(auto sub = start + 2; sub < start + source_size; sub += 1 + trigger::get_trigger_payload_size(sub)) {
+			if(reads_only_tracked_values(sub, national)) {
+				if(guard.data.empty()) {
+					guard.data.push_back(uint16_t(trigger::generic_scope));
+					guard.data.push_back(uint16_t(1));
+				}
+				guard.data.insert(guard.data.end(), sub, sub + 1 + trigger::get_trigger_payload_size(sub));
+			}
+		}
+		if(!guard.data.empty())
+			guard.data[1] = uint16_t(guard.data.size() - 1);
+	}
+	if(!guard.data.empty())
+		guard.known_false_at.resize(entity_count + ve::vector_size, 0);
+}
+
+void build_event_trigger_guards(sys::state& state) {
+	state.free_national_event_guards.resize(state.world.free_national_event_size());
+	for(auto e : state.world.in_free_national_event) {
+		build_trigger_guard(state, e.get_trigger(), true, state.free_national_event_guards[e.id.index()], state.world.nation_size());
+	}
+	state.free_provincial_event_guards.resize(state.world.free_provincial_event_size());
+	for(auto e : state.world.in_free_provincial_event) {
+		build_trigger_guard(state, e.get_trigger(), false, state.free_provincial_event_guards[e.id.index()], state.world.province_size());
+	}
+}
+
+void note_flags_changed(sys::state& state, dcon::nation_id n) {
+	state.world.nation_set_flag_epoch(n, state.world.nation_get_flag_epoch(n) + 1);
+}
+
+// both epochs only ever grow, so their sum changes whenever one of them does; 0 is kept for "never known to be false"
+uint32_t change_epoch(sys::state& state, dcon::nation_id n) {
+	return state.world.nation_get_flag_epoch(n) + state.national_definitions.global_flag_epoch + 1;
+}
+uint32_t change_epoch(sys::state& state, dcon::province_id) {
+	return state.national_definitions.global_flag_epoch + 1;
+}
+
+// the candidate lanes for which the guard may hold: lanes where it was already false at the current epoch are dropped without
+// evaluating anything, and lanes where it is evaluated and found to be false are remembered
+template<typename TAG>
+ve::mask_vector guard_may_hold(sys::state& state, event_trigger_guard& guard, TAG ids, ve::mask_vector candidates) {
+	auto unknown = ve::apply([&](auto id, bool candidate) {
+		return (candidate && guard.known_false_at[id.index()] != change_epoch(state, id)) ? 1.0f : 0.0f;
+	}, ids, candidates) != 0.0f;
+	if(ve::compress_mask(unknown).v == 0)
+		return unknown;
+
+	ve::mask_vector holds = trigger::evaluate(state, guard.data.data(), trigger::to_generic(ids), trigger::to_generic(ids), 0);
+	ve::apply([&](auto id, bool u, bool h) {
+		if(u && !h)
+			guard.known_false_at[id.index()] = change_epoch(state, id);
+	}, ids, unknown, holds);
+	return unknown && holds;
+}
+
+//
+// The events that pass their trigger and their random check are collected in one buffer per event of the block, so that the
+// parallel phase needs neither locks nor merging; the buffers are kept between days to avoid reallocating them. The trigger of
+// a candidate is checked again before it fires when an event already fired for the same nation earlier in the same update, or
+// when the global flags or the flags and variables of the nation changed since the parallel phase, since the immediate effects of
+// an event may have changed the outcome. Every other candidate is fired on the result of the parallel phase: unlike a full serial
+// re-check, this does not see other changes that an event makes to the state of a different nation
+//
+
+template<typename T>
+void gather_event_candidates(std::vector<std::vector<T>>& per_event, std::vector<T>& total) {
+	size_t count = 0;
+	for(auto& v : per_event)
+		count += v.size();
+	total.clear();
+	total.reserve(count);
+	for(auto& v : per_event)
+		total.insert(total.end(), v.begin(), v.end());
+	std::sort(total.begin(), total.end());
+}
+
 void update_events(sys::state& state) {
 	uint32_t n_block_size = state.world.free_national_event_size() / 32;
 	uint32_t p_block_size = state.world.free_provincial_event_size() / 32;
 
 	uint32_t block_index = (state.current_date.value & 31);
 
-	concurrency::combinable<std::vector<event_nation_pair>> events_triggered;
+	static std::vector<std::vector<event_nation_pair>> events_triggered;
+	static std::vector<event_nation_pair> total_vector;
+	static std::vector<std::vector<event_prov_pair>> p_events_triggered;
+	static std::vector<event_prov_pair> total_p_vector;
+	static std::vector<uint8_t> nation_had_event;
+	static std::vector<uint32_t> evaluated_at_epoch;
+
+	// nations may have been created since the guards were built
+	for(auto& g : state.free_national_event_guards) {
+		if(!g.data.empty() && g.known_false_at.size() < state.world.nation_size() + ve::vector_size)
+			g.known_false_at.resize(state.world.nation_size() + ve::vector_size, 0);
+	}
 
 	auto n_block_end = block_index == 31 ? state.world.free_national_event_size() : n_block_size * (block_index + 1);
+	if(events_triggered.size() < n_block_end - n_block_size * block_index)
+		events_triggered.resize(n_block_end - n_block_size * block_index);
+	for(auto& v : events_triggered)
+		v.clear();
 	concurrency::parallel_for(n_block_size * block_index, n_block_end, [&](uint32_t i) {
+		auto& triggered = events_triggered[i - n_block_size * block_index];
 		dcon::free_national_event_id id{dcon::national_event_id::value_base_t(i)};
 		auto mod = state.world.free_national_event_get_mtth(id);
 		auto t = state.world.free_national_event_get_trigger(id);
+		auto t_fn = state.world.free_national_event_get_trigger_fn(id);
+		auto mod_fn = state.world.free_national_event_get_mtth_fn(id);
 
 		if(state.world.free_national_event_get_only_once(id) == false || state.world.free_national_event_get_has_been_triggered(id) == false) {
 			ve::execute_serial_fast<dcon::nation_id>(state.world.nation_size(), [&](auto ids) {
@@ -535,12 +720,21 @@ void update_events(sys::state& state) {
 				non positive, we take the probability of the event occurring as 0.000001. If the value is less than 0.001, the
 				event is guaranteed to happen. Otherwise, the probability is the multiplicative inverse of the value.
 				*/
+				ve::mask_vector has_provinces = state.world.nation_get_owned_province_count(ids) != 0;
+				if(i < state.free_national_event_guards.size() && !state.free_national_event_guards[i].data.empty()) {
+					has_provinces = guard_may_hold(state, state.free_national_event_guards[i], ids, has_provinces);
+				}
 				auto some_exist = t
-					? (state.world.nation_get_owned_province_count(ids) != 0) && trigger::evaluate(state, t, trigger::to_generic(ids), trigger::to_generic(ids), 0)
-					: (state.world.nation_get_owned_province_count(ids) != 0);
+					? has_provinces && (t_fn != 0
+						? jit_event_trigger(state, t_fn, t, ids, has_provinces)
+						: trigger::evaluate(state, t, trigger::to_generic(ids), trigger::to_generic(ids), 0))
+					: has_provinces;
 				if(ve::compress_mask(some_exist).v != 0) {
-					auto chances = mod ?
-						trigger::evaluate_multiplicative_modifier(state, mod, trigger::to_generic(ids), trigger::to_generic(ids), 0) : ve::fp_vector{ 1.0f };
+					auto chances = mod
+						? (mod_fn != 0
+							? jit_event_mtth(state, mod_fn, mod, ids, some_exist)
+							: trigger::evaluate_multiplicative_modifier(state, mod, trigger::to_generic(ids), trigger::to_generic(ids), 0))
+						: ve::fp_vector{ 1.0f };
 					auto adj_chance = 1.0f - ve::select(chances <= 1.0f, 1.0f, 1.0f / (chances));
 					auto adj_chance_2 = adj_chance * adj_chance;
 					auto adj_chance_4 = adj_chance_2 * adj_chance_2;
@@ -552,7 +746,7 @@ void update_events(sys::state& state) {
 								auto owned_range = state.world.nation_get_province_ownership(n);
 								if(condition && owned_range.begin() != owned_range.end()) {
 									if(float(rng::get_random(state, uint32_t((i << 1) ^ n.index())) & 0xFFFFFF) / float(0xFFFFFF + 1) >= c) {
-										events_triggered.local().push_back(event_nation_pair{n, id});
+										triggered.push_back(event_nation_pair{n, id});
 									}
 								}
 							},
@@ -563,25 +757,38 @@ void update_events(sys::state& state) {
 		}
 	});
 
-	auto total_vector = events_triggered.combine([](auto& a, auto& b) {
-		std::vector<event_nation_pair> result(a.begin(), a.end());
-		result.insert(result.end(), b.begin(), b.end());
-		return result;
-	});
-	std::sort(total_vector.begin(), total_vector.end());
+	nation_had_event.assign(state.world.nation_size(), uint8_t(0));
+	evaluated_at_epoch.resize(state.world.nation_size());
+	for(auto n : state.world.in_nation)
+		evaluated_at_epoch[n.id.index()] = change_epoch(state, n.id);
+	// whether the result of the parallel phase may still be used for a nation
+	auto unchanged = [&](dcon::nation_id n) {
+		// nations created by the effects of an event have no result from the parallel phase
+		if(uint32_t(n.index()) >= evaluated_at_epoch.size())
+			return false;
+		return nation_had_event[n.index()] == 0 && evaluated_at_epoch[n.index()] == change_epoch(state, n);
+	};
+
+	gather_event_candidates(events_triggered, total_vector);
 	for(auto& v : total_vector) {
-		if(trigger::evaluate(state, state.world.free_national_event_get_trigger(v.e), trigger::to_generic(v.n), trigger::to_generic(v.n), 0)) {
+		if(unchanged(v.n) || free_event_trigger_holds(state, v.e, v.n)) {
 			event::trigger_national_event(state, v.e, v.n, uint32_t((state.current_date.value) ^ (v.e.value << 3)), uint32_t(v.n.value));
+			nation_had_event[v.n.index()] = 1;
 		}
 	}
 
-	concurrency::combinable<std::vector<event_prov_pair>> p_events_triggered;
-
 	auto p_block_end = block_index == 31 ? state.world.free_provincial_event_size() : p_block_size * (block_index + 1);
+	if(p_events_triggered.size() < p_block_end - p_block_size * block_index)
+		p_events_triggered.resize(p_block_end - p_block_size * block_index);
+	for(auto& v : p_events_triggered)
+		v.clear();
 	concurrency::parallel_for(p_block_size * block_index, p_block_end, [&](uint32_t i) {
+		auto& triggered = p_events_triggered[i - p_block_size * block_index];
 		dcon::free_provincial_event_id id{dcon::free_provincial_event_id::value_base_t(i)};
 		auto mod = state.world.free_provincial_event_get_mtth(id);
 		auto t = state.world.free_provincial_event_get_trigger(id);
+		auto t_fn = state.world.free_provincial_event_get_trigger_fn(id);
+		auto mod_fn = state.world.free_provincial_event_get_mtth_fn(id);
 
 		if(state.world.free_provincial_event_get_only_once(id) == false || state.world.free_provincial_event_get_has_been_triggered(id) == false) {
 			ve::execute_serial_fast<dcon::province_id>(uint32_t(state.province_definitions.first_sea_province.index()),
@@ -591,12 +798,20 @@ void update_events(sys::state& state) {
 						happen.
 						*/
 						auto owners = state.world.province_get_nation_from_province_ownership(ids);
-						auto some_exist = t ? (owners != dcon::nation_id{}) &&
-							trigger::evaluate(state, t, trigger::to_generic(ids), trigger::to_generic(ids), 0)
-							: (owners != dcon::nation_id{});
+						ve::mask_vector owned = owners != dcon::nation_id{};
+						if(i < state.free_provincial_event_guards.size() && !state.free_provincial_event_guards[i].data.empty()) {
+							owned = guard_may_hold(state, state.free_provincial_event_guards[i], ids, owned);
+						}
+						auto some_exist = t
+							? owned && (t_fn != 0
+								? jit_event_trigger(state, t_fn, t, ids, owned)
+								: trigger::evaluate(state, t, trigger::to_generic(ids), trigger::to_generic(ids), 0))
+							: owned;
 						if(ve::compress_mask(some_exist).v != 0) {
 							auto chances = mod
-								? trigger::evaluate_multiplicative_modifier(state, mod, trigger::to_generic(ids), trigger::to_generic(ids), 0)
+								? (mod_fn != 0
+									? jit_event_mtth(state, mod_fn, mod, ids, some_exist)
+									: trigger::evaluate_multiplicative_modifier(state, mod, trigger::to_generic(ids), trigger::to_generic(ids), 0))
 								: ve::fp_vector{ 2.0f };
 							auto adj_chance = 1.0f - ve::select(chances <= 2.0f, 1.0f, 2.0f / chances);
 							auto adj_chance_2 = adj_chance * adj_chance;
@@ -608,7 +823,7 @@ void update_events(sys::state& state) {
 									[&](dcon::province_id p, dcon::nation_id o, float c, bool condition) {
 										if(condition) {
 											if(float(rng::get_random(state, uint32_t((i << 1) ^ p.index())) & 0xFFFFFF) / float(0xFFFFFF + 1) >= c) {
-												p_events_triggered.local().push_back(event_prov_pair{ p, id });
+												triggered.push_back(event_prov_pair{ p, id });
 											}
 										}
 									},
@@ -618,15 +833,19 @@ void update_events(sys::state& state) {
 		}
 	});
 
-	auto total_p_vector = p_events_triggered.combine([](auto& a, auto& b) {
-		std::vector<event_prov_pair> result(a.begin(), a.end());
-		result.insert(result.end(), b.begin(), b.end());
-		return result;
-	});
-	std::sort(total_p_vector.begin(), total_p_vector.end());
+	// the national events that fired above are already part of the state the provincial triggers were evaluated against
+	nation_had_event.assign(state.world.nation_size(), uint8_t(0));
+	evaluated_at_epoch.resize(state.world.nation_size());
+	for(auto n : state.world.in_nation)
+		evaluated_at_epoch[n.id.index()] = change_epoch(state, n.id);
+
+	gather_event_candidates(p_events_triggered, total_p_vector);
 	for(auto& v : total_p_vector) {
-		if(trigger::evaluate(state, state.world.free_provincial_event_get_trigger(v.e), trigger::to_generic(v.p), trigger::to_generic(v.p), 0)) {
+		auto owner = state.world.province_get_nation_from_province_ownership(v.p);
+		if((owner && unchanged(owner)) || free_event_trigger_holds(state, v.e, v.p)) {
 			trigger_provincial_event(state, v.e, v.p, uint32_t((state.current_date.value) ^ (v.e.value << 3)), uint32_t(v.p.value));
+			if(owner && uint32_t(owner.index()) < nation_had_event.size())
+				nation_had_event[owner.index()] = 1;
 		}
 	}
 
@@ -728,6 +947,58 @@ void fire_fixed_event(sys::state& state, std::vector<nations::fixed_event> const
 	}
 }
 
+void fire_fixed_event_for_all_nations(sys::state& state, std::vector<nations::fixed_event> const& v) {
+	/*
+	The conditions are evaluated for every nation up front, in parallel and with the vector trigger evaluator, so they all see the
+	state from before any of the chosen events has fired. The events themselves are then picked and fired serially in nation
+	order, exactly as fire_fixed_event would.
+	*/
+	auto const nation_count = state.world.nation_size();
+	static std::vector<uint8_t> holds;
+	holds.clear();
+	holds.resize(v.size() * nation_count, uint8_t(0));
+
+	concurrency::parallel_for(0, int32_t(v.size()), [&](int32_t k) {
+		auto condition = v[k].condition;
+		ve::execute_serial_fast<dcon::nation_id>(nation_count, [&](auto ids) {
+			ve::mask_vector has_provinces = state.world.nation_get_owned_province_count(ids) != 0;
+			auto result = condition
+				? has_provinces && trigger::evaluate(state, condition, trigger::to_generic(ids), trigger::to_generic(ids), -1)
+				: has_provinces;
+			ve::apply([&](dcon::nation_id n, bool h) {
+				if(h && n.index() < int32_t(nation_count))
+					holds[size_t(k) * nation_count + n.index()] = uint8_t(1);
+			}, ids, result);
+		});
+	});
+
+	static std::vector<internal_n_epair> valid_list;
+	for(auto n : state.world.in_nation) {
+		if(n.get_owned_province_count() == 0)
+			continue;
+
+		valid_list.clear();
+		int32_t total_chances = 0;
+		for(size_t k = 0; k < v.size(); ++k) {
+			if(holds[k * nation_count + n.id.index()] != 0) {
+				total_chances += v[k].chance;
+				valid_list.push_back(internal_n_epair{ v[k].id, v[k].chance });
+			}
+		}
+		if(valid_list.size() > 0) {
+			auto primary_slot = trigger::to_generic(n.id);
+			int32_t random_value = int32_t(rng::get_random(state, uint32_t(primary_slot + (n.get_owned_province_count() << 3))) % total_chances);
+			for(auto& fe : valid_list) {
+				random_value -= fe.chance;
+				if(random_value < 0) {
+					trigger_national_event(state, fe.e, n, state.current_date.value, uint32_t(primary_slot), primary_slot, slot_type::nation, -1, slot_type::none);
+					break;
+				}
+			}
+		}
+	}
+}
+
 void fire_fixed_event(sys::state& state, std::vector<nations::fixed_election_event> const& v, int32_t primary_slot, slot_type pt, dcon::nation_id this_slot, int32_t from_slot, slot_type ft) {
 	static std::vector<internal_n_epair> valid_list;
 	valid_list.clear();
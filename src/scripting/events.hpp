@@ -81,6 +81,16 @@ static_assert(sizeof(pending_human_f_p_event) ==
 	+ sizeof(pending_human_f_p_event::p)
 	+ sizeof(pending_human_f_p_event::padding));
 
+//
+// Part of the trigger of a free event that only reads flags and variables (see build_event_trigger_guards). If the guard is false
+// for a nation or province, so is the whole trigger, and it stays false until the change epoch of that nation or province moves
+// on, which lets update_events skip it without evaluating anything
+//
+struct event_trigger_guard {
+	std::vector<uint16_t> data; // trigger bytecode, empty when the event has no guard
+	std::vector<uint32_t> known_false_at; // per nation or province: the change epoch at which the guard was last false, 0 if never
+};
+
 bool is_valid_option(sys::event_option const& opt);
 
 void trigger_national_event(sys::state& state, dcon::national_event_id e, dcon::nation_id n, uint32_t r_hi, uint32_t r_lo,
@@ -94,6 +104,8 @@ void trigger_provincial_event(sys::state& state, dcon::free_provincial_event_id
 		uint32_t r_lo);
 
 void fire_fixed_event(sys::state& state, std::vector<nations::fixed_event> const& v, int32_t primary_slot, slot_type pt, dcon::nation_id this_slot, int32_t from_slot, slot_type ft);
+// fires one of the events for every nation that owns provinces, as the pulse on_actions do
+void fire_fixed_event_for_all_nations(sys::state& state, std::vector<nations::fixed_event> const& v);
 void fire_fixed_event(sys::state& state, std::vector<nations::fixed_election_event> const& v, int32_t primary_slot, slot_type pt, dcon::nation_id this_slot, int32_t from_slot, slot_type ft);
 void fire_fixed_event(sys::state& state, std::vector<nations::fixed_province_event> const& v, dcon::province_id prov, int32_t from_slot, slot_type ft);
 
@@ -105,6 +117,9 @@ void take_option(sys::state& state, pending_human_f_p_event const& e, uint8_t op
 bool would_be_duplicate_instance(sys::state& state, dcon::national_event_id e, dcon::nation_id n, sys::date date);
 void update_future_events(sys::state& state);
 void update_events(sys::state& state);
+void build_event_trigger_guards(sys::state& state);
+// must be called whenever a flag or variable of the nation changes
+void note_flags_changed(sys::state& state, dcon::nation_id n);
 
 dcon::issue_id get_election_event_issue(sys::state& state, dcon::national_event_id e);
 
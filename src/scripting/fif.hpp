@@ -11,13 +11,30 @@
 #include <span>
 #include <limits>
 
-#ifdef _WIN64
+#if defined(_WIN64) || defined(ALICE_SYSTEM_LLVM)
 #define USE_LLVM
-#else
 #endif
 
 #ifdef USE_LLVM
 
+// builds against a system llvm (see ALICE_SYSTEM_LLVM in CMakeLists.txt) must use its headers, not the bundled ones
+#ifdef ALICE_SYSTEM_LLVM
+#include <llvm-c/Core.h>
+#include <llvm-c/Types.h>
+#include <llvm-c/LLJIT.h>
+#include <llvm-c/LLJITUtils.h>
+#include <llvm-c/Analysis.h>
+#include <llvm-c/Error.h>
+#include <llvm-c/ExecutionEngine.h>
+#include <llvm-c/Orc.h>
+#include <llvm-c/OrcEE.h>
+#include <llvm-c/Linker.h>
+#include <llvm-c/lto.h>
+#include <llvm-c/Support.h>
+#include <llvm-c/Target.h>
+#include <llvm-c/TargetMachine.h>
+#include <llvm-c/Transforms/PassBuilder.h>
+#else
 #include "llvm-c/Core.h"
 #include "llvm-c/Types.h"
 #include "llvm-c/LLJIT.h"
@@ -33,6 +50,7 @@
 #include "llvm-c/Target.h"
 #include "llvm-c/TargetMachine.h"
 #include "llvm-c/Transforms/PassBuilder.h"
+#endif
 
 #ifdef _WIN64
 #define NATIVE_CC LLVMCallConv::LLVMWin64CallConv
@@ -5218,21 +5236,8 @@ inline void add_import(std::string_view name, void* ptr, fif_call interpreter_im
 }
 
 #ifdef USE_LLVM
-inline void perform_jit(environment& e) {
-	//add_exportable_functions_to_globals(e);
-
-	char* out_message = nullptr;
-	auto result = LLVMVerifyModule(e.llvm_module, LLVMVerifierFailureAction::LLVMPrintMessageAction, &out_message);
-	if(result) {
-		e.report_error(out_message);
-		return;
-	}
-	if(out_message)
-		LLVMDisposeMessage(out_message);
-	
-	LLVMDisposeBuilder(e.llvm_builder);
-	e.llvm_builder = nullptr;
-
+// creates the jit and defines the imported functions in its main library
+inline LLVMOrcJITDylibRef prepare_jit(environment& e) {
 	// ORC JIT
 	auto jit_builder = LLVMOrcCreateLLJITBuilder();
 	assert(jit_builder);
@@ -5246,22 +5251,14 @@ inline void perform_jit(environment& e) {
 		auto msg = LLVMGetErrorMessage(errora);
 		e.report_error(msg);
 		LLVMDisposeErrorMessage(msg);
-		return;
+		return nullptr;
 	}
 
 	if(!e.llvm_jit) {
 		e.report_error("failed to create jit");
-		return;
+		return nullptr;
 	}
 
-
-	LLVMOrcIRTransformLayerRef TL = LLVMOrcLLJITGetIRTransformLayer(e.llvm_jit);
-	LLVMOrcIRTransformLayerSetTransform(TL, *perform_transform, nullptr);
-
-	LLVMOrcThreadSafeModuleRef orc_mod = LLVMOrcCreateNewThreadSafeModule(e.llvm_module, e.llvm_ts_context);
-	e.llvm_module = nullptr;
-
-	LLVMOrcExecutionSessionRef execution_session = LLVMOrcLLJITGetExecutionSession(e.llvm_jit);
 	LLVMOrcJITDylibRef main_dyn_lib = LLVMOrcLLJITGetMainJITDylib(e.llvm_jit);
 	if(!main_dyn_lib) {
 		e.report_error("failed to get main dylib");
@@ -5286,9 +5283,42 @@ inline void perform_jit(environment& e) {
 			auto msg = LLVMGetErrorMessage(import_result);
 			e.report_error(msg);
 			LLVMDisposeErrorMessage(msg);
-			return;
+			return nullptr;
 		}
 	}
+	return main_dyn_lib;
+}
+
+inline bool verify_module(environment& e) {
+	char* out_message = nullptr;
+	auto result = LLVMVerifyModule(e.llvm_module, LLVMVerifierFailureAction::LLVMPrintMessageAction, &out_message);
+	if(result) {
+		e.report_error(out_message);
+		return false;
+	}
+	if(out_message)
+		LLVMDisposeMessage(out_message);
+	return true;
+}
+
+inline void perform_jit(environment& e) {
+	//add_exportable_functions_to_globals(e);
+
+	if(!verify_module(e))
+		return;
+
+	LLVMDisposeBuilder(e.llvm_builder);
+	e.llvm_builder = nullptr;
+
+	auto main_dyn_lib = prepare_jit(e);
+	if(!main_dyn_lib)
+		return;
+
+	LLVMOrcIRTransformLayerRef TL = LLVMOrcLLJITGetIRTransformLayer(e.llvm_jit);
+	LLVMOrcIRTransformLayerSetTransform(TL, *perform_transform, nullptr);
+
+	LLVMOrcThreadSafeModuleRef orc_mod = LLVMOrcCreateNewThreadSafeModule(e.llvm_module, e.llvm_ts_context);
+	e.llvm_module = nullptr;
 
 	auto error = LLVMOrcLLJITAddLLVMIRModule(e.llvm_jit, main_dyn_lib, orc_mod);
 	if(error) {
@@ -5298,6 +5328,64 @@ inline void perform_jit(environment& e) {
 		return;
 	}
 }
+
+// identifies what the object code produced by compile_to_object depends on besides the fif source: the llvm version and the
+// target cpu and its features
+inline std::string jit_target_description(environment const& e) {
+	unsigned major = 0;
+	unsigned minor = 0;
+	unsigned patch = 0;
+	LLVMGetVersion(&major, &minor, &patch);
+	return std::to_string(major) + "." + std::to_string(minor) + "." + std::to_string(patch) + ";" + e.llvm_target_triple + ";" + e.llvm_target_cpu + ";" + e.llvm_target_cpu_features;
+}
+
+// optimizes the module the same way the jit would and compiles it to an object file that perform_jit_from_object can load,
+// now or in a later run; returns an empty vector on failure, leaving the module in place
+inline std::vector<char> compile_to_object(environment& e) {
+	if(!verify_module(e))
+		return std::vector<char>{};
+
+	module_transform(nullptr, e.llvm_module);
+
+	char* out_message = nullptr;
+	LLVMMemoryBufferRef buffer = nullptr;
+	if(LLVMTargetMachineEmitToMemoryBuffer(e.llvm_target_machine, e.llvm_module, LLVMCodeGenFileType::LLVMObjectFile, &out_message, &buffer)) {
+		if(out_message) {
+			e.report_error(out_message);
+			LLVMDisposeMessage(out_message);
+		}
+		return std::vector<char>{};
+	}
+	std::vector<char> result(LLVMGetBufferStart(buffer), LLVMGetBufferStart(buffer) + LLVMGetBufferSize(buffer));
+	LLVMDisposeMemoryBuffer(buffer);
+	return result;
+}
+
+// replaces the module with previously compiled object code
+inline bool perform_jit_from_object(environment& e, char const* data, size_t size) {
+	if(e.llvm_builder) {
+		LLVMDisposeBuilder(e.llvm_builder);
+		e.llvm_builder = nullptr;
+	}
+	if(e.llvm_module) {
+		LLVMDisposeModule(e.llvm_module);
+		e.llvm_module = nullptr;
+	}
+
+	auto main_dyn_lib = prepare_jit(e);
+	if(!main_dyn_lib)
+		return false;
+
+	auto buffer = LLVMCreateMemoryBufferWithMemoryRangeCopy(data, size, "fif_object");
+	auto error = LLVMOrcLLJITAddObjectFile(e.llvm_jit, main_dyn_lib, buffer);
+	if(error) {
+		auto msg = LLVMGetErrorMessage(error);
+		e.report_error(msg);
+		LLVMDisposeErrorMessage(msg);
+		return false;
+	}
+	return true;
+}
 #endif
 
 inline int32_t* colon_definition(fif::state_stack&, int32_t* p, fif::environment* e) {
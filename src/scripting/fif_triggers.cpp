@@ -3535,7 +3535,7 @@ TRIGGER_FUNCTION(tf_invention_pop) {
 TRIGGER_FUNCTION(tf_test) {
 	auto sid = trigger::payload(tval[1]).str_id;
 	auto tid = ws.world.stored_trigger_get_function(sid);
-	return test_trigger_generic(ws.trigger_data.data() + ws.trigger_data_indices[tid.index() + 1], ws) + truth_inversion(tval[0]);
+	return test_trigger_generic(ws.optimized_trigger_data.data() + ws.optimized_trigger_data_indices[tid.index() + 1], ws) + truth_inversion(tval[0]);
 }
 
 TRIGGER_FUNCTION(tf_has_building_bank) {
@@ -3646,7 +3646,7 @@ std::string multiplicative_modifier(sys::state& state, dcon::value_modifier_key
 	for(uint32_t i = 0; i < base.segments_count; ++i) {
 		auto seg = state.value_modifier_segments[base.first_segment_offset + i];
 		if(seg.condition) {
-			result += test_trigger_generic(state.trigger_data.data() + state.trigger_data_indices[seg.condition.index() + 1], state);
+			result += test_trigger_generic(state.optimized_trigger_data.data() + state.optimized_trigger_data_indices[seg.condition.index() + 1], state);
 			result += "1.0 swap " + std::to_string(seg.factor) + " swap select r> * >r "; // multiply by either 1.0 or the segement factor depending on bool result
 		}
 	}
@@ -3660,7 +3660,7 @@ std::string additive_modifier(sys::state& state, dcon::value_modifier_key modifi
 	for(uint32_t i = 0; i < base.segments_count; ++i) {
 		auto seg = state.value_modifier_segments[base.first_segment_offset + i];
 		if(seg.condition) {
-			result += test_trigger_generic(state.trigger_data.data() + state.trigger_data_indices[seg.condition.index() + 1], state);
+			result += test_trigger_generic(state.optimized_trigger_data.data() + state.optimized_trigger_data_indices[seg.condition.index() + 1], state);
 			result += "0.0 swap " + std::to_string(seg.factor) + " swap select r> + >r "; // multiply by either 1.0 or the segement factor depending on bool result
 		}
 	}
@@ -3669,7 +3669,7 @@ std::string additive_modifier(sys::state& state, dcon::value_modifier_key modifi
 }
 
 std::string evaluate(sys::state& state, dcon::trigger_key key) {
-	return test_trigger_generic(state.trigger_data.data() + state.trigger_data_indices[key.index() + 1], state);
+	return test_trigger_generic(state.optimized_trigger_data.data() + state.optimized_trigger_data_indices[key.index() + 1], state);
 }
 
 #undef CALLTYPE
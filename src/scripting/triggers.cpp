@@ -5664,7 +5664,7 @@ TRIGGER_FUNCTION(tf_invention_pop) {
 TRIGGER_FUNCTION(tf_test) {
 	auto sid = trigger::payload(tval[1]).str_id;
 	auto tid = ws.world.stored_trigger_get_function(sid);
-	auto test_result = test_trigger_generic<return_type>(ws.trigger_data.data() + ws.trigger_data_indices[tid.index() + 1], ws, primary_slot, this_slot, from_slot);
+	auto test_result = test_trigger_generic<return_type>(ws.optimized_trigger_data.data() + ws.optimized_trigger_data_indices[tid.index() + 1], ws, primary_slot, this_slot, from_slot);
 	return compare_to_true(tval[0], test_result);
 }
 
@@ -5810,12 +5810,14 @@ return_type CALLTYPE test_trigger_generic(uint16_t const* tval, sys::state& ws,
 #undef TRIGGER_FUNCTION
 
 float evaluate_multiplicative_modifier(sys::state& state, dcon::value_modifier_key modifier, int32_t primary, int32_t this_slot, int32_t from_slot) {
+	sys::script_profile_scope profile{ state.script_profile, sys::script_kind::value_modifier, modifier.index(), 1 };
 	auto base = state.value_modifiers[modifier];
 	float product = base.factor;
 	for(uint32_t i = 0; i < base.segments_count && product != 0; ++i) {
 		auto seg = state.value_modifier_segments[base.first_segment_offset + i];
 		if(seg.condition) {
-			if(test_trigger_generic<bool>(state.trigger_data.data() + state.trigger_data_indices[seg.condition.index() + 1], state, primary,
+			sys::script_profile_scope condition_profile{ state.script_profile, sys::script_kind::trigger, seg.condition.index(), 1 };
+			if(test_trigger_generic<bool>(state.optimized_trigger_data.data() + state.optimized_trigger_data_indices[seg.condition.index() + 1], state, primary,
 						 this_slot, from_slot)) {
 				product *= seg.factor;
 			}
@@ -5824,12 +5826,14 @@ float evaluate_multiplicative_modifier(sys::state& state, dcon::value_modifier_k
 	return product;
 }
 float evaluate_additive_modifier(sys::state& state, dcon::value_modifier_key modifier, int32_t primary, int32_t this_slot, int32_t from_slot) {
+	sys::script_profile_scope profile{ state.script_profile, sys::script_kind::value_modifier, modifier.index(), 1 };
 	auto base = state.value_modifiers[modifier];
 	float sum = base.base;
 	for(uint32_t i = 0; i < base.segments_count; ++i) {
 		auto seg = state.value_modifier_segments[base.first_segment_offset + i];
 		if(seg.condition) {
-			if(test_trigger_generic<bool>(state.trigger_data.data() + state.trigger_data_indices[seg.condition.index() + 1], state, primary,
+			sys::script_profile_scope condition_profile{ state.script_profile, sys::script_kind::trigger, seg.condition.index(), 1 };
+			if(test_trigger_generic<bool>(state.optimized_trigger_data.data() + state.optimized_trigger_data_indices[seg.condition.index() + 1], state, primary,
 						 this_slot, from_slot)) {
 				sum += seg.factor;
 			}
@@ -5839,26 +5843,30 @@ float evaluate_additive_modifier(sys::state& state, dcon::value_modifier_key mod
 }
 
 ve::fp_vector evaluate_multiplicative_modifier(sys::state& state, dcon::value_modifier_key modifier, ve::contiguous_tags<int32_t> primary, ve::tagged_vector<int32_t> this_slot, int32_t from_slot) {
+	sys::script_profile_scope profile{ state.script_profile, sys::script_kind::value_modifier, modifier.index(), int32_t(ve::vector_size) };
 	auto base = state.value_modifiers[modifier];
 	ve::fp_vector product = base.factor;
 	for(uint32_t i = 0; i < base.segments_count; ++i) {
 		auto seg = state.value_modifier_segments[base.first_segment_offset + i];
 		if(seg.condition) {
+			sys::script_profile_scope condition_profile{ state.script_profile, sys::script_kind::trigger, seg.condition.index(), int32_t(ve::vector_size) };
 			auto res = test_trigger_generic<ve::mask_vector>(
-					state.trigger_data.data() + state.trigger_data_indices[seg.condition.index() + 1], state, primary, this_slot, from_slot);
+					state.optimized_trigger_data.data() + state.optimized_trigger_data_indices[seg.condition.index() + 1], state, primary, this_slot, from_slot);
 			product = ve::select(res, product * seg.factor, product);
 		}
 	}
 	return product;
 }
 ve::fp_vector evaluate_additive_modifier(sys::state& state, dcon::value_modifier_key modifier, ve::contiguous_tags<int32_t> primary, ve::tagged_vector<int32_t> this_slot, int32_t from_slot) {
+	sys::script_profile_scope profile{ state.script_profile, sys::script_kind::value_modifier, modifier.index(), int32_t(ve::vector_size) };
 	auto base = state.value_modifiers[modifier];
 	ve::fp_vector sum = base.base;
 	for(uint32_t i = 0; i < base.segments_count; ++i) {
 		auto seg = state.value_modifier_segments[base.first_segment_offset + i];
 		if(seg.condition) {
+			sys::script_profile_scope condition_profile{ state.script_profile, sys::script_kind::trigger, seg.condition.index(), int32_t(ve::vector_size) };
 			auto res = test_trigger_generic<ve::mask_vector>(
-					state.trigger_data.data() + state.trigger_data_indices[seg.condition.index() + 1], state, primary, this_slot, from_slot);
+					state.optimized_trigger_data.data() + state.optimized_trigger_data_indices[seg.condition.index() + 1], state, primary, this_slot, from_slot);
 			sum = ve::select(res, sum + seg.factor, sum);
 		}
 	}
@@ -5866,26 +5874,30 @@ ve::fp_vector evaluate_additive_modifier(sys::state& state, dcon::value_modifier
 }
 
 ve::fp_vector evaluate_multiplicative_modifier(sys::state& state, dcon::value_modifier_key modifier, ve::contiguous_tags<int32_t> primary, ve::contiguous_tags<int32_t> this_slot, int32_t from_slot) {
+	sys::script_profile_scope profile{ state.script_profile, sys::script_kind::value_modifier, modifier.index(), int32_t(ve::vector_size) };
 	auto base = state.value_modifiers[modifier];
 	ve::fp_vector product = base.factor;
 	for(uint32_t i = 0; i < base.segments_count; ++i) {
 		auto seg = state.value_modifier_segments[base.first_segment_offset + i];
 		if(seg.condition) {
+			sys::script_profile_scope condition_profile{ state.script_profile, sys::script_kind::trigger, seg.condition.index(), int32_t(ve::vector_size) };
 			auto res = test_trigger_generic<ve::mask_vector>(
-					state.trigger_data.data() + state.trigger_data_indices[seg.condition.index() + 1], state, primary, this_slot, from_slot);
+					state.optimized_trigger_data.data() + state.optimized_trigger_data_indices[seg.condition.index() + 1], state, primary, this_slot, from_slot);
 			product = ve::select(res, product * seg.factor, product);
 		}
 	}
 	return product;
 }
 ve::fp_vector evaluate_additive_modifier(sys::state& state, dcon::value_modifier_key modifier, ve::contiguous_tags<int32_t> primary, ve::contiguous_tags<int32_t> this_slot, int32_t from_slot) {
+	sys::script_profile_scope profile{ state.script_profile, sys::script_kind::value_modifier, modifier.index(), int32_t(ve::vector_size) };
 	auto base = state.value_modifiers[modifier];
 	ve::fp_vector sum = base.base;
 	for(uint32_t i = 0; i < base.segments_count; ++i) {
 		auto seg = state.value_modifier_segments[base.first_segment_offset + i];
 		if(seg.condition) {
+			sys::script_profile_scope condition_profile{ state.script_profile, sys::script_kind::trigger, seg.condition.index(), int32_t(ve::vector_size) };
 			auto res = test_trigger_generic<ve::mask_vector>(
-					state.trigger_data.data() + state.trigger_data_indices[seg.condition.index() + 1], state, primary, this_slot, from_slot);
+					state.optimized_trigger_data.data() + state.optimized_trigger_data_indices[seg.condition.index() + 1], state, primary, this_slot, from_slot);
 			sum = ve::select(res, sum + seg.factor, sum);
 		}
 	}
@@ -5893,7 +5905,8 @@ ve::fp_vector evaluate_additive_modifier(sys::state& state, dcon::value_modifier
 }
 
 bool evaluate(sys::state& state, dcon::trigger_key key, int32_t primary, int32_t this_slot, int32_t from_slot) {
-	return test_trigger_generic<bool>(state.trigger_data.data() + state.trigger_data_indices[key.index() + 1], state, primary,
+	sys::script_profile_scope profile{ state.script_profile, sys::script_kind::trigger, key.index(), 1 };
+	return test_trigger_generic<bool>(state.optimized_trigger_data.data() + state.optimized_trigger_data_indices[key.index() + 1], state, primary,
 			this_slot, from_slot);
 }
 bool evaluate(sys::state& state, uint16_t const* data, int32_t primary, int32_t this_slot, int32_t from_slot) {
@@ -5902,7 +5915,8 @@ bool evaluate(sys::state& state, uint16_t const* data, int32_t primary, int32_t
 
 ve::mask_vector evaluate(sys::state& state, dcon::trigger_key key, ve::contiguous_tags<int32_t> primary,
 		ve::tagged_vector<int32_t> this_slot, int32_t from_slot) {
-	return test_trigger_generic<ve::mask_vector>(state.trigger_data.data() + state.trigger_data_indices[key.index() + 1], state,
+	sys::script_profile_scope profile{ state.script_profile, sys::script_kind::trigger, key.index(), int32_t(ve::vector_size) };
+	return test_trigger_generic<ve::mask_vector>(state.optimized_trigger_data.data() + state.optimized_trigger_data_indices[key.index() + 1], state,
 			primary, this_slot, from_slot);
 }
 ve::mask_vector evaluate(sys::state& state, uint16_t const* data, ve::contiguous_tags<int32_t> primary,
@@ -5912,7 +5926,8 @@ ve::mask_vector evaluate(sys::state& state, uint16_t const* data, ve::contiguous
 
 ve::mask_vector evaluate(sys::state& state, dcon::trigger_key key, ve::tagged_vector<int32_t> primary,
 		ve::tagged_vector<int32_t> this_slot, int32_t from_slot) {
-	return test_trigger_generic<ve::mask_vector>(state.trigger_data.data() + state.trigger_data_indices[key.index() + 1], state,
+	sys::script_profile_scope profile{ state.script_profile, sys::script_kind::trigger, key.index(), int32_t(ve::vector_size) };
+	return test_trigger_generic<ve::mask_vector>(state.optimized_trigger_data.data() + state.optimized_trigger_data_indices[key.index() + 1], state,
 			primary, this_slot, from_slot);
 }
 ve::mask_vector evaluate(sys::state& state, uint16_t const* data, ve::tagged_vector<int32_t> primary,
@@ -5922,7 +5937,8 @@ ve::mask_vector evaluate(sys::state& state, uint16_t const* data, ve::tagged_vec
 
 ve::mask_vector evaluate(sys::state& state, dcon::trigger_key key, ve::contiguous_tags<int32_t> primary,
 		ve::contiguous_tags<int32_t> this_slot, int32_t from_slot) {
-	return test_trigger_generic<ve::mask_vector>(state.trigger_data.data() + state.trigger_data_indices[key.index() + 1], state,
+	sys::script_profile_scope profile{ state.script_profile, sys::script_kind::trigger, key.index(), int32_t(ve::vector_size) };
+	return test_trigger_generic<ve::mask_vector>(state.optimized_trigger_data.data() + state.optimized_trigger_data_indices[key.index() + 1], state,
 			primary, this_slot, from_slot);
 }
 ve::mask_vector evaluate(sys::state& state, uint16_t const* data, ve::contiguous_tags<int32_t> primary,
@@ -2,6 +2,7 @@
 #include "system_state.hpp"
 #include "date_interface.hpp"
 #include "cyto_any.hpp"
+#include "tick_scheduler.hpp"
 
 TEST_CASE("string pool tests", "[misc_tests]") {
 	std::unique_ptr<sys::state> state = std::make_unique<sys::state>();
@@ -225,3 +226,26 @@ TEST_CASE("cyto payload tests", "[misc_tests]") {
 		REQUIRE(any_cast<void *>(vp_payload) == (void *)nullptr);
 	}
 }
+
+TEST_CASE("tick stage conflicts", "[misc_tests]") {
+	REQUIRE(sys::tick_tables_overlap("nation", "nation.rank"));
+	REQUIRE(sys::tick_tables_overlap("nation.rank", "nation.rank"));
+	REQUIRE(!sys::tick_tables_overlap("nation.rank", "nation.military_score"));
+	REQUIRE(!sys::tick_tables_overlap("nation", "nation_adjacency"));
+	REQUIRE(sys::tick_tables_overlap("*", "pop"));
+
+	std::unique_ptr<sys::state> state = std::make_unique<sys::state>();
+	std::vector<int32_t> order;
+	std::atomic<int32_t> independent = 0;
+
+	sys::tick_graph graph;
+	graph.add("a", [&](sys::state&) { order.push_back(0); }, { "nation" }, { "nation.rank" });
+	graph.add("b", [&](sys::state&) { ++independent; }, { "pop" }, { "pop.size" });
+	graph.add("c", [&](sys::state&) { order.push_back(1); }, { "nation.rank" }, { "nation.military_score" });
+	graph.add("d", [&](sys::state&) { order.push_back(2); }, { "nation.military_score" }, { });
+	graph.run(*state);
+
+	REQUIRE(independent.load() == 1);
+	REQUIRE(order == std::vector<int32_t>{ 0, 1, 2 });
+	REQUIRE(graph.stages.empty());
+}
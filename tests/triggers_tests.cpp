@@ -828,6 +828,154 @@ TEST_CASE("batch-individual comparision", "[trigger_tests]") {
 	}
 }
 
+TEST_CASE("trigger optimization", "[trigger_tests]") {
+	{
+		// AND = { any_pop = { ... } always = yes is_vassal = yes is_vassal = yes }
+		std::vector<uint16_t> t;
+		t.push_back(uint16_t(trigger::generic_scope));
+		t.push_back(uint16_t(9));
+		t.push_back(uint16_t(trigger::x_pop_scope_nation | trigger::is_existence_scope));
+		t.push_back(uint16_t(3));
+		t.push_back(uint16_t(trigger::association_eq | trigger::owns));
+		t.push_back(uint16_t(5));
+		t.push_back(uint16_t(trigger::association_eq | trigger::no_payload | trigger::always));
+		t.push_back(uint16_t(trigger::association_eq | trigger::no_payload | trigger::is_vassal));
+		t.push_back(uint16_t(trigger::association_eq | trigger::no_payload | trigger::is_vassal));
+		t.push_back(uint16_t(trigger::association_eq | trigger::no_payload | trigger::is_greater_power_nation));
+
+		const auto new_size = parsers::optimize_trigger(t.data());
+
+		REQUIRE(8 == new_size);
+		REQUIRE(t[0] == uint16_t(trigger::generic_scope));
+		REQUIRE(t[1] == uint16_t(7));
+		REQUIRE(t[2] == uint16_t(trigger::association_eq | trigger::no_payload | trigger::is_vassal));
+		REQUIRE(t[3] == uint16_t(trigger::association_eq | trigger::no_payload | trigger::is_greater_power_nation));
+		REQUIRE(t[4] == uint16_t(trigger::x_pop_scope_nation | trigger::is_existence_scope));
+		REQUIRE(t[5] == uint16_t(3));
+		REQUIRE(t[6] == uint16_t(trigger::association_eq | trigger::owns));
+		REQUIRE(t[7] == uint16_t(5));
+	}
+	{
+		// OR = { is_vassal = yes AND = { always = yes always = no } }
+		std::vector<uint16_t> t;
+		t.push_back(uint16_t(trigger::generic_scope | trigger::is_disjunctive_scope));
+		t.push_back(uint16_t(6));
+		t.push_back(uint16_t(trigger::association_eq | trigger::no_payload | trigger::is_vassal));
+		t.push_back(uint16_t(trigger::generic_scope));
+		t.push_back(uint16_t(3));
+		t.push_back(uint16_t(trigger::association_eq | trigger::no_payload | trigger::always));
+		t.push_back(uint16_t(trigger::association_ne | trigger::no_payload | trigger::always));
+
+		const auto new_size = parsers::optimize_trigger(t.data());
+
+		REQUIRE(1 == new_size);
+		REQUIRE(t[0] == uint16_t(trigger::association_eq | trigger::no_payload | trigger::is_vassal));
+	}
+	{
+		// OR = { is_vassal = yes always = yes }
+		std::vector<uint16_t> t;
+		t.push_back(uint16_t(trigger::generic_scope | trigger::is_disjunctive_scope));
+		t.push_back(uint16_t(3));
+		t.push_back(uint16_t(trigger::association_eq | trigger::no_payload | trigger::is_vassal));
+		t.push_back(uint16_t(trigger::association_eq | trigger::no_payload | trigger::always));
+
+		const auto new_size = parsers::optimize_trigger(t.data());
+
+		REQUIRE(1 == new_size);
+		REQUIRE(t[0] == uint16_t(trigger::association_eq | trigger::no_payload | trigger::always));
+	}
+}
+
+TEST_CASE("optimized triggers evaluate identically", "[trigger_tests]") {
+	// the scenario keeps the triggers as they were parsed, for the tooltips, next to the optimized ones that are evaluated
+	auto ws = load_testing_scenario_file();
+	REQUIRE(ws->optimized_trigger_data_indices.size() == ws->trigger_data_indices.size());
+	REQUIRE(ws->optimized_trigger_data != ws->trigger_data);
+
+	auto parsed = [&](dcon::trigger_key t) {
+		return ws->trigger_data.data() + ws->trigger_data_indices[t.index() + 1];
+	};
+	auto optimized = [&](dcon::trigger_key t) {
+		return ws->optimized_trigger_data.data() + ws->optimized_trigger_data_indices[t.index() + 1];
+	};
+
+	// counts the parts of the compared triggers that the optimizer may reorder or fold, to make sure that they were covered
+	int32_t scope_changes = 0;
+	int32_t disjunctions = 0;
+	int32_t negations = 0;
+	std::vector<bool> counted(ws->trigger_data_indices.size(), false);
+	auto count_shape = [&](dcon::trigger_key t) {
+		if(counted[t.index() + 1])
+			return;
+		counted[t.index() + 1] = true;
+		std::vector<uint16_t> copy(parsed(t), parsed(t) + 1 + trigger::get_trigger_payload_size(parsed(t)));
+		trigger::recurse_over_triggers(copy.data(), [&](uint16_t* source) {
+			if((source[0] & trigger::code_mask) >= trigger::first_scope_code) {
+				if((source[0] & trigger::code_mask) != trigger::generic_scope)
+					++scope_changes;
+				if((source[0] & trigger::is_disjunctive_scope) != 0)
+					++disjunctions;
+			} else if((source[0] & trigger::association_mask) == trigger::association_ne) {
+				++negations;
+			}
+		});
+	};
+	auto compare = [&](dcon::trigger_key t, int32_t primary, int32_t this_slot) {
+		count_shape(t);
+		auto parsed_result = trigger::evaluate(*ws, parsed(t), primary, this_slot, 0);
+		auto optimized_result = trigger::evaluate(*ws, optimized(t), primary, this_slot, 0);
+		REQUIRE(parsed_result == optimized_result);
+	};
+	auto compare_modifier = [&](dcon::value_modifier_key m, int32_t primary, int32_t this_slot) {
+		auto const& description = ws->value_modifiers[m];
+		for(uint32_t i = 0; i < description.segments_count; ++i) {
+			auto const& segment = ws->value_modifier_segments[description.first_segment_offset + i];
+			if(segment.condition)
+				compare(segment.condition, primary, this_slot);
+		}
+	};
+
+	// nation scope
+	for(auto e : ws->world.in_free_national_event) {
+		auto t = e.get_trigger();
+		if(!t)
+			continue;
+		for(auto n : ws->world.in_nation) {
+			compare(t, trigger::to_generic(n.id), trigger::to_generic(n.id));
+		}
+	}
+	// province scope
+	for(auto e : ws->world.in_free_provincial_event) {
+		auto t = e.get_trigger();
+		if(!t)
+			continue;
+		for(auto p : ws->world.in_province) {
+			if(p.get_nation_from_province_ownership())
+				compare(t, trigger::to_generic(p.id), trigger::to_generic(p.id));
+		}
+	}
+	// pop scope: the issue and ideology attraction modifiers of a sample of the pops of each type
+	std::vector<int32_t> sampled(ws->world.pop_type_size(), 0);
+	for(auto p : ws->world.in_pop) {
+		auto type = p.get_poptype();
+		if(!type || sampled[type.id.index()] >= 64)
+			continue;
+		++sampled[type.id.index()];
+		for(auto i : ws->world.in_issue_option) {
+			if(auto m = type.get_issues(i); m)
+				compare_modifier(m, trigger::to_generic(p.id), trigger::to_generic(p.id));
+		}
+		for(auto i : ws->world.in_ideology) {
+			if(auto m = type.get_ideology(i); m)
+				compare_modifier(m, trigger::to_generic(p.id), trigger::to_generic(p.id));
+		}
+	}
+
+	REQUIRE(scope_changes > 0);
+	REQUIRE(disjunctions > 0);
+	REQUIRE(negations > 0);
+}
+
 TEST_CASE("trigger payload translation", "[trigger_tests]") {
 	{
 		auto old_d = trigger::to_generic(dcon::province_id{42});